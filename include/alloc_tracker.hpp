@@ -0,0 +1,50 @@
+/***********************************************************************************************
+*
+*   alloc_tracker.hpp - Counts the heap allocations made by the game thread.
+*
+*   Copyright (c) 2025 Josh Hayden (@BlinkDynamo)
+*
+*   Blink's Thinks is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License v3.0 as published
+*   by the Free Software Foundation.
+*
+*   Blink's Thinks is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*
+***********************************************************************************************/
+
+#pragma once
+
+// Standard library.
+#include <cstdint>
+
+namespace engine::alloc_tracker
+{
+
+// Allocations are only counted in builds that define 'GAME_ALLOC_TRACKING'
+// ('make linux ALLOCS=1'), which replace the global 'operator new' and 'operator delete'.
+#ifdef GAME_ALLOC_TRACKING
+inline constexpr bool enabled = true;
+#else
+inline constexpr bool enabled = false;
+#endif
+
+struct counts
+{
+    uint64_t allocations;
+    uint64_t bytes;
+};
+
+// Count the allocations made by the calling thread from now on. Other threads, such as the
+// audio thread, are never counted.
+void track_this_thread();
+
+// The allocations counted since the start of the program. Always zero without tracking.
+counts get_counts();
+
+} // NAMESPACE ENGINE::ALLOC_TRACKER.
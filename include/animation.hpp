@@ -22,6 +22,7 @@
 
 // Source.
 #include "entity.hpp"
+#include "glyph_run.hpp"
 
 // Standard library.
 #include <string>
@@ -31,13 +32,13 @@ using std::string;
 namespace engine
 {
 
-class anim_raylib : public entity
+class anim_raylib final : public entity
 {
     public:
         anim_raylib();
         bool is_finished();
         void update() override;
-        void draw() override;
+        void draw(float alpha) override;
 
     private:
         // Position.
@@ -51,24 +52,24 @@ class anim_raylib : public entity
         int m_right_side_rec_height;
 
         // Counters and state machines.
-        int m_frame_counter;
+        size_t m_tick_counter;
         int m_letters_count;
         int m_state;
 
         float m_alpha;
 };
 
-class anim_self_credit : public entity
+class anim_self_credit final : public entity
 {
     public:
         anim_self_credit();
         bool is_finished();
-        void draw() override;
+        void draw(float alpha) override;
         void update() override;
 
     private:
         // Counters.
-        int m_frame_counter;
+        size_t m_tick_counter;
         int m_letters_count;
        
         // state of the animation.
@@ -88,6 +89,9 @@ class anim_self_credit : public entity
         Font m_font;
         Vector2 m_text_position;
 
+        // The letters of 'm_text', placed once so each frame only draws them.
+        glyph_run m_run;
+
         // Colors.
         Color m_bg_color;
 };
@@ -0,0 +1,50 @@
+/***********************************************************************************************
+*
+*   arena_allocated.hpp - A base for objects that live in a level's arena.
+*
+*   Copyright (c) 2025 Josh Hayden (@BlinkDynamo)
+*
+*   Blink's Thinks is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License v3.0 as published
+*   by the Free Software Foundation.
+*
+*   Blink's Thinks is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*
+***********************************************************************************************/
+
+#pragma once
+
+// Standard library.
+#include <cstddef>
+#include <memory_resource>
+
+namespace engine
+{
+
+// Objects deriving from this can only be created in an arena, as 'new (arena) T(...)'. A plain
+// 'new T(...)' does not compile. 'delete' still runs the destructor as usual, but gives nothing
+// back: the memory is released all at once with the arena, when the level that owns it is
+// destroyed.
+class arena_allocated
+{
+    public:
+        static void* operator new(std::size_t size, std::pmr::memory_resource& arena)
+        {
+            return arena.allocate(size, alignof(std::max_align_t));
+        }
+
+        static void* operator new(std::size_t size) = delete;
+
+        static void operator delete(void* /* ptr */) {}
+
+        // Called only if a constructor throws.
+        static void operator delete(void* /* ptr */, std::pmr::memory_resource& /* arena */) {}
+};
+
+} // NAMESPACE ENGINE.
@@ -33,12 +33,15 @@ namespace engine
 class audio_manager
 {
     public:
-        audio_manager();
+        // A headless audio manager never opens the audio device. Every sound and track
+        // still resolves by name, but playing them does nothing.
+        audio_manager(bool headless = false);
         ~audio_manager();
 
         void update();
 
         Sound get_sound_effect(string sound_name) { return m_sound_effects.at(sound_name); }
+        void play_sound(Sound sound);
         void set_next_music(string track_name, bool looping = true);
         void shift_pitch(float pitch);
 
@@ -46,8 +49,8 @@ class audio_manager
         unordered_map<string, Music> m_music_tracks;
         unordered_map<string, Sound> m_sound_effects;
 
-        static constexpr int m_frame_dur_mix = 90;
-        static constexpr int m_frame_dur_pitch = 60;
+        static constexpr int m_tick_dur_mix = 90;
+        static constexpr int m_tick_dur_pitch = 60;
 
         Music* m_current_music;
         Music* m_next_music;
@@ -55,11 +58,13 @@ class audio_manager
         float m_current_pitch;
         float m_next_pitch;
 
-        int m_frame_count_mix;
-        int m_frame_count_pitch;
+        int m_tick_count_mix;
+        int m_tick_count_pitch;
 
         bool m_mixing;
         bool m_shifting;
+
+        bool m_headless;
 };
 
 } // NAMESPACE ENGINE.
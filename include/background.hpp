@@ -26,7 +26,7 @@
 namespace engine
 {
 
-class background : public entity
+class background final : public entity
 {
     public:
         background(
@@ -37,7 +37,8 @@ class background : public entity
         ~background();
 
         void update() override;
-        void draw() override;
+        void draw(float alpha) override;
+        void save_state() override { m_prev_scroll_offset = m_scroll_offset; }
 
         static float get_scroll_offset() { return m_scroll_offset; }
         static void set_scroll_offset(float scroll_offset) { m_scroll_offset = scroll_offset; }
@@ -48,6 +49,7 @@ class background : public entity
         int m_square_size;
 
         static float m_scroll_offset;
+        static float m_prev_scroll_offset;
 };
 
 } // NAMESPACE ENGINE.
@@ -26,8 +26,10 @@
 #include "text.hpp"
 
 // Standard library.
+#include <array>
 #include <vector>
 #include <optional>
+#include <variant>
 
 using std::vector;
 using std::optional;
@@ -35,7 +37,7 @@ using std::optional;
 namespace engine
 {
 
-class button : public entity
+class button final : public entity
 {
     public:
         button(
@@ -49,26 +51,57 @@ class button : public entity
         ~button();
 
         void update() override;
-        void draw() override;
+        void draw(float alpha) override;
+        void save_state() override;
+
+        // A button rests when it is not hovered, moving or changing scale, and neither its text
+        // nor any of its traits are animating.
+        bool is_resting() override;
     
-        // Checks if the mouse is within the button's rectangle.
-        bool is_hovered();
+        // Whether this is the topmost button under the mouse, as resolved by the level at the
+        // start of the tick.
+        bool is_hovered() { return m_hovered; }
 
         // Checks if 'is_hovered()' and the mouse being pressed are both true.
         bool is_pressed();
 
-        void add_trait(button_trait* trait) { m_traits.push_back(trait); }
+        // Called by the level's hover pass when the button starts or stops being hovered.
+        void set_hovered(bool hovered)
+        {
+            m_hovered = hovered;
+            wake();
+        }
+
+        // A trait of one of the known types, stored in the button itself. Updating it needs no
+        // allocation and no virtual call. Up to 'm_max_static_traits' can be added.
+        using static_trait = std::variant<grows_when_hovered, grabbable>;
+        void add_trait(static_trait trait);
 
-        string get_text() { return m_text_obj->get_text_str(); }
+        // Any other trait, created in the level's arena. The button deletes it.
+        void add_trait(button_trait* trait)
+        {
+            m_traits.push_back(trait);
+            wake();
+        }
+
+        const string& get_text() { return m_text_obj->get_text_str(); }
 
         text* get_text_obj() { return m_text_obj; }
 
         Rectangle get_base_rec() { return m_rec; }
-        void set_base_rec(Rectangle rec) { m_rec = rec; }
+        void set_base_rec(Rectangle rec)
+        {
+            m_rec = rec;
+            wake();
+        }
 
         Rectangle get_scaled_rec() { return m_scaled_rec; }
 
-        void set_scale(float scale) { m_scale = scale; }
+        void set_scale(float scale)
+        {
+            m_scale = scale;
+            wake();
+        }
 
         float get_scale() { return m_scale; }
 
@@ -81,6 +114,9 @@ class button : public entity
         void set_outline_size(float outline_size) { m_outline_size = outline_size; }
 
     private:
+        // Enough for the common pairing of 'grows_when_hovered' and 'grabbable'.
+        static constexpr size_t m_max_static_traits = 2;
+
         // The pointer to the text object of the button. The button handles updating and
         // drawing it's child text within it's own 'update()' and 'draw()' methods.
         text* m_text_obj;
@@ -112,9 +148,19 @@ class button : public entity
         // What 'm_rectangle' and the text object's 'm_fontSize' are multiplied by.
         float m_scale;
 
+        // The scale of the previous tick, blended with 'm_scale' on draw.
+        float m_prev_scale;
+
+        // Whether the button is the topmost one under the mouse this tick.
+        bool m_hovered;
+
         // The sound effect played when the button is pressed.
         optional<Sound> m_sfx_press;
 
+        // The traits stored in the button, of which the first 'm_static_trait_count' are used.
+        std::array<static_trait, m_max_static_traits> m_static_traits;
+        size_t m_static_trait_count;
+
         // The storage container to hold all active traits attached to the button.
         vector<button_trait*> m_traits;
 
@@ -0,0 +1,35 @@
+/***********************************************************************************************
+*
+*   dispatch_bench.hpp - A benchmark of the per-entity update and draw dispatch.
+*
+*   Copyright (c) 2025 Josh Hayden (@BlinkDynamo)
+*
+*   Blink's Thinks is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License v3.0 as published
+*   by the Free Software Foundation.
+*
+*   Blink's Thinks is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*
+***********************************************************************************************/
+
+#pragma once
+
+// Standard library.
+#include <cstddef>
+
+namespace engine
+{
+
+// Build a scene of 'entity_count' texts, buttons and labels, added interleaved across four
+// layers, and log how long its update and draw passes take through the virtual calls of
+// 'entity' over one list in creation order, and batched by class like a level, averaged over
+// 'rounds'. Draws are only timed with a window.
+void run_dispatch_bench(size_t entity_count, size_t rounds);
+
+} // NAMESPACE ENGINE.
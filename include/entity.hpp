@@ -20,13 +20,24 @@
 
 #pragma once
 
+// Source.
+#include "arena_allocated.hpp"
+#include "kinematics.hpp"
+
 // Raylib.
 #include "raylib.h"
 
+// Standard library.
+#include <cstdint>
+
 namespace engine
 {
 
-class entity
+class entity_layers;
+class entity_handles;
+class spatial_grid;
+
+class entity : public arena_allocated
 {
     public:
         entity(
@@ -36,26 +47,101 @@ class entity
         );
         virtual ~entity() = default;
 
+        // Move the entity by its speed. Entities in a level have already been moved by the
+        // level's kinematics pass when this runs, so only detached entities, such as the text
+        // of a button, move here.
         virtual void update();
-        virtual void draw() = 0;
 
-        virtual Vector2 get_position() { return m_position; }
-        virtual void set_position(Vector2 position) { m_position = position; }
+        // Draw the entity blended between its previous and current tick by 'alpha' (0 to 1).
+        virtual void draw(float alpha) = 0;
+
+        // Remember the current state as the previous tick's state. Called before 'update()'.
+        virtual void save_state();
+
+        // Whether 'update()' would change nothing until something changes the entity from
+        // outside. A level takes resting entities off its update list after their update, until
+        // 'wake()' puts them back. Setters that change what 'update()' works from call 'wake()'.
+        virtual bool is_resting() { return false; }
+
+        // Put the entity back on its level's update list. An entity updated by its owner, such
+        // as the text of a button, wakes the owner instead.
+        void wake();
+        bool is_awake() { return m_awake; }
+
+        // Set by the entity that updates and draws this one, which is then never in a level.
+        void set_owner(entity* owner) { m_owner = owner; }
+
+        // Move the motion of the entity into 'store'. Called once, by 'level::add_entity()'.
+        void attach(kinematics& store);
+
+        Vector2 get_position()
+        {
+            return m_kinematics != nullptr ? m_kinematics->get_position(m_kinematics_slot) : m_position;
+        }
+        void set_position(Vector2 position);
 
         virtual int get_layer() { return m_layer; }
-        virtual void set_layer(int layer) { m_layer = layer; }
+        virtual void set_layer(int layer);
 
-        virtual Vector2 get_speed() { return m_speed; }
-        virtual void set_speed(Vector2 speed) { m_speed = speed; }
+        Vector2 get_speed()
+        {
+            return m_kinematics != nullptr ? m_kinematics->get_speed(m_kinematics_slot) : m_speed;
+        }
+        void set_speed(Vector2 speed);
 
     protected:
-        Vector2 m_position;
+        // The position blended between the previous and current tick.
+        Vector2 get_render_position(float alpha);
+
+        static float lerp(float a, float b, float t) { return a + (b - a) * t; }
+
+        // Whether the entity has no speed.
+        bool is_still()
+        {
+            const Vector2 speed = get_speed();
+            return speed.x == 0.0f && speed.y == 0.0f;
+        }
+
         int m_layer;
-        Vector2 m_speed;
 
         static constexpr Vector2 m_default_position = {0, 0};
         static constexpr int m_default_layer = 0;
         static constexpr Vector2 m_default_speed = {0, 0};
+
+    private:
+        // The motion of a detached entity. Once attached, the store holds it instead.
+        Vector2 m_position;
+        Vector2 m_prev_position;
+        Vector2 m_speed;
+
+        kinematics* m_kinematics = nullptr;
+        size_t m_kinematics_slot = 0;
+
+        // The container the entity was added to, and the layer it is bucketed under there,
+        // which lags behind 'm_layer' until the container re-buckets it. 'm_bucket_index' is its
+        // place in that bucket, and so in draw order. 'm_bucket_type' is the index of the
+        // entity's class in 'entity_types'.
+        entity_layers* m_layers = nullptr;
+        int m_bucket_layer = 0;
+        size_t m_bucket_index = 0;
+        size_t m_bucket_type = 0;
+
+        // Whether the entity is on the update list of 'm_layers', or waiting to be put back.
+        bool m_awake = false;
+
+        entity* m_owner = nullptr;
+        bool m_layer_dirty = false;
+
+        // The slot of the entity in the game's handle table, if it has one.
+        uint32_t m_handle_index = UINT32_MAX;
+
+        // The slot of the entity in its level's spatial grid, if it is in one.
+        static constexpr uint32_t m_no_grid_slot = UINT32_MAX;
+        uint32_t m_grid_slot = m_no_grid_slot;
+
+        friend class entity_layers;
+        friend class entity_handles;
+        friend class spatial_grid;
 };
 
 } // NAMESPACE ENGINE.
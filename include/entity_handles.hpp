@@ -0,0 +1,91 @@
+/***********************************************************************************************
+*
+*   entity_handles.hpp - Generational handles to entities that may be destroyed.
+*
+*   Copyright (c) 2025 Josh Hayden (@BlinkDynamo)
+*
+*   Blink's Thinks is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License v3.0 as published
+*   by the Free Software Foundation.
+*
+*   Blink's Thinks is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*
+***********************************************************************************************/
+
+#pragma once
+
+// Source.
+#include "entity.hpp"
+
+// Standard library.
+#include <cstdint>
+#include <vector>
+
+using std::vector;
+
+namespace engine
+{
+
+// A reference to an entity that is safe to hold past the entity's lifetime, such as across a
+// level swap. It is a slot index and the generation of the slot when the handle was made.
+// Destroying the entity bumps the generation, so old handles resolve to 'nullptr'.
+template <typename T>
+struct handle
+{
+    uint32_t index = m_null_index;
+    uint32_t generation = 0;
+
+    bool is_null() const { return index == m_null_index; }
+
+    bool operator==(const handle&) const = default;
+
+    static constexpr uint32_t m_null_index = UINT32_MAX;
+};
+
+class entity_handles
+{
+    public:
+        // Give 'ent' a slot. Slots of destroyed entities are reused.
+        void add(entity* ent);
+
+        // Free the slot of 'ent', invalidating every handle to it.
+        void remove(entity* ent);
+
+        template <typename T>
+        handle<T> get_handle(T* ent)
+        {
+            if (ent == nullptr || ent->m_handle_index == handle<T>::m_null_index) {
+                return {};
+            }
+            return {ent->m_handle_index, m_slots[ent->m_handle_index].generation};
+        }
+
+        // The entity, or 'nullptr' if it has been destroyed since the handle was made.
+        template <typename T>
+        T* resolve(handle<T> h)
+        {
+            if (h.index >= m_slots.size() || m_slots[h.index].generation != h.generation) {
+                return nullptr;
+            }
+            return static_cast<T*>(m_slots[h.index].ent);
+        }
+
+    private:
+        struct slot
+        {
+            entity* ent;
+            uint32_t generation;
+            uint32_t next_free;
+        };
+
+        vector<slot> m_slots;
+        uint32_t m_free_head = handle<entity>::m_null_index;
+};
+
+} // NAMESPACE ENGINE.
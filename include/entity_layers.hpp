@@ -0,0 +1,154 @@
+/***********************************************************************************************
+*
+*   entity_layers.hpp - A level's entities, bucketed by layer in draw order.
+*
+*   Copyright (c) 2025 Josh Hayden (@BlinkDynamo)
+*
+*   Blink's Thinks is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License v3.0 as published
+*   by the Free Software Foundation.
+*
+*   Blink's Thinks is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*
+***********************************************************************************************/
+
+#pragma once
+
+// Source.
+#include "entity.hpp"
+#include "entity_types.hpp"
+
+// Standard library.
+#include <cstddef>
+#include <map>
+#include <memory_resource>
+#include <vector>
+
+namespace engine
+{
+
+// Entities are kept in one bucket per layer, lowest layer first. Within a bucket they stay in
+// the order they were added, so adding is a map lookup and an append rather than a scan of the
+// whole level, and later entities draw over earlier ones.
+class entity_layers
+{
+    public:
+        // The buckets are allocated from 'resource', which is the level's arena.
+        explicit entity_layers(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+        // 'type' is the index of the class of 'ent' in 'entity_types'.
+        void add(entity* ent, size_t type);
+
+        // Move the entities whose layer changed since the last call to the end of their new
+        // layer, as if they had just been added there.
+        void rebucket();
+
+        // Whether 'a' is drawn after 'b', and so over it where they overlap. Both must be in
+        // this container, and are compared as of the last 'rebucket()'.
+        bool is_drawn_above(entity* a, entity* b);
+
+        // Called by 'entity::set_layer()' for entities in this container.
+        void mark_dirty(entity* ent);
+
+        // Called by 'entity::wake()' for entities in this container.
+        void wake(entity* ent);
+
+        // Visit every entity in draw order. 'fn' must not add entities or change layers
+        // through the container while visiting.
+        template <typename F>
+        void for_each(F&& fn)
+        {
+            for (auto& [layer, bucket] : m_buckets) {
+                for (entity* ent : bucket) {
+                    fn(ent);
+                }
+            }
+        }
+
+        // Like 'for_each()', but 'fn' is called with a pointer to the entity's own class. Each
+        // run of neighbouring entities of one class is visited in a loop of direct calls instead
+        // of one virtual call per entity. The order of 'for_each()' is kept.
+        template <typename F>
+        void for_each_typed(F&& fn)
+        {
+            for (auto& [layer, bucket] : m_buckets) {
+                const size_t count = bucket.size();
+                size_t run_end = 0;
+                for (size_t run_begin = 0; run_begin < count; run_begin = run_end) {
+                    const size_t type = bucket[run_begin]->m_bucket_type;
+                    run_end = run_begin + 1;
+                    while (run_end < count && bucket[run_end]->m_bucket_type == type) {
+                        ++run_end;
+                    }
+
+                    entity_types::visit(type, [&fn, &bucket, run_begin, run_end]<typename T>() {
+                        for (size_t i = run_begin; i < run_end; ++i) {
+                            fn(static_cast<T*>(bucket[i]));
+                        }
+                    });
+                }
+            }
+        }
+
+        // Visit every awake entity with a pointer to its own class, one class at a time. Those
+        // for which 'fn' returns false are put to sleep, and are not visited again until woken.
+        // Entities woken since the last call are visited along with the rest.
+        template <typename F>
+        void for_each_awake(F&& fn)
+        {
+            for (entity* ent : m_waking) {
+                m_awake_lists[ent->m_bucket_type].push_back(ent);
+            }
+            m_waking.clear();
+
+            for (size_t type = 0; type < entity_types::size; ++type) {
+                std::pmr::vector<entity*>& awake = m_awake_lists[type];
+                entity_types::visit(type, [&fn, &awake]<typename T>() {
+                    // Compact the list in place, keeping the order of the entities that stay.
+                    size_t kept = 0;
+                    for (entity* ent : awake) {
+                        if (fn(static_cast<T*>(ent))) {
+                            awake[kept++] = ent;
+                        }
+                        else {
+                            ent->m_awake = false;
+                        }
+                    }
+                    awake.resize(kept);
+                });
+            }
+        }
+
+        size_t size() { return m_size; }
+
+        // The number of entities on the update list.
+        size_t awake_size();
+
+        // Forget every entity without touching them, as they may already be destroyed.
+        void clear();
+
+    private:
+        // Append 'ent' to the bucket of its 'm_bucket_layer'.
+        void push_back(entity* ent);
+
+        std::pmr::map<int, std::pmr::vector<entity*>> m_buckets;
+
+        // Entities whose layer changed since the last 'rebucket()', so it touches only the
+        // entities that moved.
+        std::pmr::vector<entity*> m_dirty;
+
+        // The entities on the update list, one list per class of 'entity_types'. Entities woken
+        // while the lists are being visited wait in 'm_waking' until the next visit.
+        std::pmr::vector<std::pmr::vector<entity*>> m_awake_lists;
+        std::pmr::vector<entity*> m_waking;
+
+        size_t m_size = 0;
+};
+
+} // NAMESPACE ENGINE.
@@ -20,6 +20,9 @@
 
 #pragma once
 
+// Source.
+#include "arena_allocated.hpp"
+
 // Raylib.
 #include "raylib.h"
 
@@ -28,34 +31,41 @@ namespace engine
 
 class button;
 
-class button_trait
+// Traits are updated by their button once per tick. 'hovered' is 'btn.is_hovered()', resolved
+// once per tick by the button's level. A button only rests once all of its traits do.
+class button_trait : public arena_allocated
 {
     public:
         virtual ~button_trait() = default;
-        virtual void update(button& b) = 0;
+        virtual void update(button& btn, bool hovered) = 0;
+        virtual bool is_resting() { return false; }
 };
 
-class grows_when_hovered : public button_trait
+// The traits below are final, so a button that stores them by value, through
+// 'button::add_trait(T trait)', calls them directly instead of through the vtable.
+class grows_when_hovered final : public button_trait
 {
     public:
-        grows_when_hovered(int frame_duration = 10, float target_scale = 1.2f);
-        void update(button& btn) override;
+        grows_when_hovered(int tick_duration = 10, float target_scale = 1.2f);
+        void update(button& btn, bool hovered) override;
+        bool is_resting() override;
 
-        void set_frame_duration(int frame_duration) { m_frame_duration = frame_duration; }
+        void set_tick_duration(int tick_duration) { m_tick_duration = tick_duration; }
         void set_target_scale(float target_scale) { m_target_scale = target_scale; }
 
     private:
-        int m_frame_duration;
+        int m_tick_duration;
         float m_current_scale;
         float m_target_scale;
         float m_default_scale;
 };
 
-class grabbable : public button_trait
+class grabbable final : public button_trait
 {
     public:
         grabbable();
-        void update(button& btn) override;
+        void update(button& btn, bool hovered) override;
+        bool is_resting() override { return !m_is_grabbed; }
 
     private:
         bool m_is_grabbed;
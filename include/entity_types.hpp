@@ -0,0 +1,78 @@
+/***********************************************************************************************
+*
+*   entity_types.hpp - The concrete entity classes a level can hold.
+*
+*   Copyright (c) 2025 Josh Hayden (@BlinkDynamo)
+*
+*   Blink's Thinks is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License v3.0 as published
+*   by the Free Software Foundation.
+*
+*   Blink's Thinks is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*
+***********************************************************************************************/
+
+#pragma once
+
+// Source.
+#include "animation.hpp"
+#include "background.hpp"
+#include "button.hpp"
+#include "label.hpp"
+#include "overlay.hpp"
+#include "text.hpp"
+
+// Standard library.
+#include <cstddef>
+#include <type_traits>
+
+namespace engine
+{
+
+template <typename... Ts>
+struct entity_type_list
+{
+    static constexpr size_t size = sizeof...(Ts);
+
+    template <typename T>
+    static constexpr bool contains = (std::is_same_v<T, Ts> || ...);
+
+    // The position of 'T' in the list.
+    template <typename T>
+    static constexpr size_t index_of()
+    {
+        static_assert(contains<T>, "T is not in the entity type list.");
+
+        size_t index = 0;
+        ((std::is_same_v<T, Ts> ? false : (++index, true)) && ...);
+        return index;
+    }
+
+    // Call 'fn.template operator()<T>()' with the class at 'index'.
+    template <typename F>
+    static void visit(size_t index, F&& fn)
+    {
+        size_t i = 0;
+        ((i++ == index ? (fn.template operator()<Ts>(), true) : false) || ...);
+    }
+};
+
+// Every class here is final, so once the class of an entity is known its calls are direct. The
+// order only sets the order of the update lists. Drawing keeps the order entities were added.
+using entity_types = entity_type_list<
+    background,
+    anim_raylib,
+    anim_self_credit,
+    text,
+    button,
+    label,
+    overlay
+>;
+
+} // NAMESPACE ENGINE.
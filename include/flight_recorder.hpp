@@ -0,0 +1,99 @@
+/***********************************************************************************************
+*
+*   flight_recorder.hpp - An always-on ring of recent frame timings, dumped on budget overruns.
+*
+*   Copyright (c) 2025 Josh Hayden (@BlinkDynamo)
+*
+*   Blink's Thinks is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License v3.0 as published
+*   by the Free Software Foundation.
+*
+*   Blink's Thinks is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*
+***********************************************************************************************/
+
+#pragma once
+
+// Source.
+#include "frame_profiler.hpp"
+
+// Standard library.
+#include <array>
+#include <atomic>
+#include <string>
+
+using std::string;
+
+namespace engine
+{
+
+class flight_recorder
+{
+    public:
+        // A budget of zero never dumps.
+        flight_recorder(float budget_ms = m_default_budget_ms);
+
+        float get_budget_ms() { return m_budget_ms; }
+        void set_budget_ms(float budget_ms) { m_budget_ms = budget_ms; }
+
+        // Dumps are written as '<prefix><n>.json'.
+        void set_dump_prefix(const string& prefix) { m_dump_prefix = prefix; }
+
+        // Record a finished frame. When a frame runs over budget, the ring is dumped once the
+        // next 'm_frames_after_overrun' frames have been recorded too, so the dump shows what
+        // led up to the hitch and what followed it. The budget is checked against the work of
+        // the frame, which excludes the present phase where vsync is waited on.
+        void record(
+            const string& level_name,
+            size_t tick_count,
+            const std::array<float, frame_profiler::phase_count>& phase_ms,
+            float frame_ms
+        );
+
+        // Write a dump still waiting on the frames after its overrun.
+        void flush();
+
+    private:
+        static constexpr float m_default_budget_ms = 1000.0f / 60.0f;
+        static constexpr size_t m_frame_capacity = 512;
+        static constexpr size_t m_frames_after_overrun = 60;
+        static constexpr size_t m_max_dumps = 16;
+        static constexpr size_t m_level_name_size = 32;
+
+        struct frame
+        {
+            size_t index;
+            size_t tick_count;
+            float frame_ms;
+            std::array<float, frame_profiler::phase_count> phase_ms;
+            std::array<char, m_level_name_size> level_name;
+        };
+
+        // Write every frame in the ring, oldest first.
+        void dump();
+
+        std::array<frame, m_frame_capacity> m_frames;
+
+        // The number of frames ever recorded. A frame's slot is its index modulo the capacity.
+        // Only the game loop writes; the index is published after the slot is filled so the
+        // ring never needs a lock to be read.
+        std::atomic<size_t> m_frame_count;
+
+        float m_budget_ms;
+
+        // The frame that ran over budget, and how many frames remain before it is dumped.
+        size_t m_overrun_index;
+        size_t m_frames_until_dump;
+        bool m_dump_pending;
+
+        size_t m_dump_count;
+        string m_dump_prefix;
+};
+
+} // NAMESPACE ENGINE.
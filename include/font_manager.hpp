@@ -0,0 +1,84 @@
+/***********************************************************************************************
+*
+*   font_manager.hpp - The distance field text font and the shader that draws it.
+*
+*   Copyright (c) 2025 Josh Hayden (@BlinkDynamo)
+*
+*   Blink's Thinks is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License v3.0 as published
+*   by the Free Software Foundation.
+*
+*   Blink's Thinks is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*
+***********************************************************************************************/
+
+#pragma once
+
+// Source.
+#include "glyph_run.hpp"
+
+// Raylib.
+#include "raylib.h"
+
+// Standard library.
+#include <vector>
+
+using std::vector;
+
+namespace engine
+{
+
+// At startup the glyphs of raylib's default font are turned into a signed distance field. Text
+// drawn from it with the text shader stays sharp at any scale, and gets its outline from the
+// same quads as its fill, instead of from eight more copies of the string.
+class font_manager
+{
+    public:
+        // A headless font manager builds no atlas or shader. Its text font is raylib's default
+        // font, which has no glyphs loaded without a window, and drawing does nothing.
+        font_manager(bool headless = false);
+        ~font_manager();
+
+        // Laid out exactly like raylib's default font at the same size.
+        Font get_text_font() { return m_text_font; }
+
+        // Draw a mesh baked from a run of the text font, placed by 'transform', in 'color' with
+        // an outline of 'outline_size' pixels in 'outline_color' when it is visible. 'font_size'
+        // is the size it ends up drawn at. Glyphs off the canvas are culled, and the glyphs drawn
+        // are returned.
+        size_t draw_text(glyph_mesh& mesh, Matrix transform, Color color, Color outline_color,
+                       float outline_size, float font_size);
+
+    private:
+        // Every pixel of the default font covers this many pixels of the atlas.
+        static constexpr int m_upscale = 8;
+
+        // How far from the edge of a glyph the field reaches, in atlas pixels. Outlines wider
+        // than this are cut short.
+        static constexpr int m_spread = 4 * m_upscale;
+
+        static constexpr int m_atlas_width = 2048;
+
+        // Fill the atlas and glyph tables of 'm_text_font' from the glyphs of 'font'.
+        void build_atlas(Font font);
+
+        Font m_text_font;
+        vector<Rectangle> m_recs;
+        vector<GlyphInfo> m_glyphs;
+
+        Shader m_text_shader;
+        Material m_text_material;
+        int m_outline_color_loc;
+        int m_outline_width_loc;
+        int m_smoothing_loc;
+
+        bool m_headless;
+};
+
+} // NAMESPACE ENGINE.
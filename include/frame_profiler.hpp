@@ -0,0 +1,152 @@
+/***********************************************************************************************
+*
+*   frame_profiler.hpp - Per-phase frame timing and its in-game overlay.
+*
+*   Copyright (c) 2025 Josh Hayden (@BlinkDynamo)
+*
+*   Blink's Thinks is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License v3.0 as published
+*   by the Free Software Foundation.
+*
+*   Blink's Thinks is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*
+***********************************************************************************************/
+
+#pragma once
+
+// Source.
+#include "alloc_tracker.hpp"
+
+// Raylib.
+#include "raylib.h"
+
+// Standard library.
+#include <array>
+#include <chrono>
+
+namespace engine
+{
+
+class frame_profiler
+{
+    public:
+        // The phases of a frame in 'game::run()'. Phases nest, and time spent in an inner phase
+        // is not counted towards the outer one, so 'ENTITY_DRAW' excludes the background and
+        // shader passes drawn inside it.
+        enum class phase {
+            LEVEL_SWAP,
+            LEVEL_UPDATE,
+            AUDIO_UPDATE,
+            BACKGROUND_DRAW,
+            SHADER_PROCESS,
+            ENTITY_DRAW,
+            PRESENT,
+            COUNT
+        };
+
+        static constexpr size_t phase_count = static_cast<size_t>(phase::COUNT);
+
+        frame_profiler();
+
+        void begin_frame();
+        void end_frame();
+
+        void begin_phase(phase p);
+        void end_phase(phase p);
+
+        // The times of the last finished frame.
+        const std::array<float, phase_count>& get_phase_times() { return m_current; }
+        float get_frame_time() { return m_frame_ms; }
+
+        // The heap allocations of the last finished frame, counted like the times, in builds
+        // with allocation tracking.
+        const std::array<alloc_tracker::counts, phase_count>& get_phase_allocs() { return m_current_allocs; }
+        alloc_tracker::counts get_frame_allocs() { return m_frame_allocs; }
+
+        // Glyph quads of text drawn and culled this frame.
+        void count_glyphs(size_t emitted, size_t culled)
+        {
+            m_glyphs_emitted += emitted;
+            m_glyphs_culled += culled;
+        }
+
+        bool is_visible() { return m_visible; }
+        void toggle_visible() { m_visible = !m_visible; }
+
+        // Draw the rolling graph and per-phase numbers in the top left of the screen.
+        void draw(size_t entity_count, size_t awake_count, size_t button_count);
+
+        static const char* get_phase_name(phase p) { return m_phase_names[static_cast<size_t>(p)]; }
+
+    private:
+        using clock = std::chrono::steady_clock;
+
+        static constexpr size_t m_history_size = 240;
+        static constexpr size_t m_max_depth = 8;
+
+        // The graph is scaled so that this many milliseconds fill its height.
+        static constexpr float m_graph_scale_ms = 33.3f;
+
+        static constexpr float m_budget_ms = 1000.0f / 60.0f;
+
+        static constexpr std::array<const char*, phase_count> m_phase_names = {
+            "level swap", "level update", "audio update", "background draw", "shader process",
+            "entity draw", "present"
+        };
+
+        static constexpr std::array<Color, phase_count> m_phase_colors = {
+            RED, ORANGE, GOLD, LIME, SKYBLUE, VIOLET, PINK
+        };
+
+        struct open_phase
+        {
+            phase p;
+            clock::time_point start;
+            alloc_tracker::counts start_allocs;
+        };
+
+        // Milliseconds spent in each phase this frame, and in the whole frame.
+        std::array<float, phase_count> m_current;
+        clock::time_point m_frame_start;
+        float m_frame_ms;
+
+        // Allocations made in each phase this frame, and in the whole frame.
+        std::array<alloc_tracker::counts, phase_count> m_current_allocs;
+        alloc_tracker::counts m_frame_start_allocs;
+        alloc_tracker::counts m_frame_allocs;
+
+        size_t m_glyphs_emitted;
+        size_t m_glyphs_culled;
+
+        std::array<open_phase, m_max_depth> m_stack;
+        size_t m_depth;
+
+        // A ring of the last 'm_history_size' frames. 'm_history_head' is the next slot written.
+        std::array<std::array<float, phase_count>, m_history_size> m_history;
+        std::array<float, m_history_size> m_frame_history;
+        std::array<std::array<uint32_t, phase_count>, m_history_size> m_alloc_history;
+        std::array<uint32_t, m_history_size> m_frame_alloc_history;
+        size_t m_history_head;
+        size_t m_history_count;
+
+        bool m_visible;
+
+        static float to_ms(clock::duration duration)
+        {
+            return std::chrono::duration<float, std::milli>(duration).count();
+        }
+
+        static void add_allocs(alloc_tracker::counts& total, alloc_tracker::counts from, alloc_tracker::counts to)
+        {
+            total.allocations += to.allocations - from.allocations;
+            total.bytes += to.bytes - from.bytes;
+        }
+};
+
+} // NAMESPACE ENGINE.
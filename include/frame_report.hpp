@@ -0,0 +1,101 @@
+/***********************************************************************************************
+*
+*   frame_report.hpp - Per-level frame-time histograms and their percentile report.
+*
+*   Copyright (c) 2025 Josh Hayden (@BlinkDynamo)
+*
+*   Blink's Thinks is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License v3.0 as published
+*   by the Free Software Foundation.
+*
+*   Blink's Thinks is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*
+***********************************************************************************************/
+
+#pragma once
+
+// Source.
+#include "frame_profiler.hpp"
+
+// Standard library.
+#include <array>
+#include <cstdint>
+#include <map>
+#include <string>
+
+using std::map;
+using std::string;
+
+namespace engine
+{
+
+class frame_report
+{
+    public:
+        frame_report();
+
+        // Frames recorded after this are counted towards 'level_name'. Nothing is written here,
+        // as it runs inside the timed level swap of the new level's first frame. The game writes
+        // the report once that frame has ended instead.
+        void begin_level(const string& level_name);
+
+        void record(const std::array<float, frame_profiler::phase_count>& phase_ms, float frame_ms);
+
+        // Write the report as JSON to '<prefix>.json' and as a table to '<prefix>.txt'.
+        void write();
+
+        // Write the report and print the table to the log.
+        void finish();
+
+        void set_path_prefix(const string& prefix) { m_path_prefix = prefix; }
+
+    private:
+        // Frame times are bucketed to 'm_bucket_ms'. Anything slower lands in the last bucket,
+        // and the exact worst case is kept alongside. A percentile that falls in the last bucket
+        // is reported as that worst case.
+        static constexpr float m_bucket_ms = 0.05f;
+        static constexpr size_t m_bucket_count = 2000;
+
+        class histogram
+        {
+            public:
+                void add(float ms);
+
+                // The upper edge of the bucket holding the given fraction of samples, or the worst
+                // case when that is the last bucket.
+                float get_percentile(float fraction) const;
+
+                float get_mean() const { return m_count == 0 ? 0.0f : static_cast<float>(m_total_ms / m_count); }
+                float get_max() const { return m_max_ms; }
+                uint64_t get_count() const { return m_count; }
+
+            private:
+                std::array<uint32_t, m_bucket_count> m_buckets{};
+                uint64_t m_count = 0;
+                double m_total_ms = 0.0;
+                float m_max_ms = 0.0f;
+        };
+
+        struct level_stats
+        {
+            histogram frame;
+            histogram update;
+            histogram draw;
+        };
+
+        string format_table();
+
+        // Sorted by level class name.
+        map<string, level_stats> m_levels;
+        level_stats* m_current;
+
+        string m_path_prefix;
+};
+
+} // NAMESPACE ENGINE.
@@ -23,11 +23,21 @@
 // Source.
 #include "level.hpp"
 #include "shader_manager.hpp"
+#include "font_manager.hpp"
 #include "audio_manager.hpp"
+#include "input.hpp"
+#include "random_manager.hpp"
+#include "frame_profiler.hpp"
+#include "flight_recorder.hpp"
+#include "frame_report.hpp"
+#include "entity_handles.hpp"
 
 // Standard library.
 #include <string>
 #include <unordered_map>
+#include <array>
+#include <span>
+#include <memory_resource>
 #include <random>
 #include <cassert>
 #include <iostream>
@@ -71,14 +81,44 @@ class game
 
         audio_manager* audio;
         shader_manager* shaders;
+        font_manager* fonts;
+        random_manager* random;
+        frame_profiler* profiler;
+        flight_recorder* flight;
+        frame_report* report;
+        entity_handles* handles;
 
         void run();
 
+        // Headless mode runs the levels without a window, GL context or audio device. The
+        // simulation is stepped as fast as possible on synthetic input. Must be set before the
+        // first call to 'get_instance()'.
+        static bool is_headless() { return m_headless; }
+        static void set_headless(bool headless) { m_headless = headless; }
+
+        // Stop 'run()' after this many ticks. Zero runs until the window is closed.
+        size_t get_tick_limit() { return m_tick_limit; }
+        void set_tick_limit(size_t tick_limit) { m_tick_limit = tick_limit; }
+
+        // The seed of the random streams. Set it before the first level is created for a
+        // reproducible session.
+        unsigned int get_seed() { return random->get_seed(); }
+        void set_seed(unsigned int seed) { random->set_seed(seed); }
+
+        // Record the input of every tick to 'path', or replay a recording in place of live
+        // input. Replaying restores the recorded seed and tick rate, and 'run()' returns when
+        // the recording ends. Returns false if the file could not be opened.
+        bool start_recording(const string& path);
+        bool start_replay(const string& path);
+
+        // Level layout numbers, drawn from the random manager's layout stream.
         int get_random_value(int min, int max);
-        vector<int> get_random_sequence(size_t count, int min, int max, vector<int> exclude = {});
+        void get_random_sequence(std::span<int> out, int min, int max,
+                                 std::initializer_list<int> exclude = {});
 
+        // Distinct colors from the bright palette, drawn from the random manager's color stream.
         Color get_random_color();
-        vector<Color> get_random_color_sequence(size_t count);
+        void get_random_color_sequence(std::span<Color> out);
 
         bool mouse_in_canvas();
 
@@ -95,18 +135,94 @@ class game
         static constexpr float get_cw() { return m_cw; }
         static constexpr float get_ch() { return m_ch; }
 
-        static constexpr size_t get_frame_rate() { return m_frame_rate; }
+        // The simulation is stepped at a fixed tick rate, independent of how fast the display
+        // draws. All per-update counters (animations, timers, fades) count ticks, not frames.
+        size_t get_tick_rate() { return m_tick_rate; }
+        void set_tick_rate(size_t tick_rate) { m_tick_rate = tick_rate; }
+
+        // The most ticks that will be run to catch up in a single frame. Time beyond this is
+        // dropped, so a long stall slows the game down instead of freezing it.
+        size_t get_max_ticks_per_frame() { return m_max_ticks_per_frame; }
+        void set_max_ticks_per_frame(size_t max_ticks) { m_max_ticks_per_frame = max_ticks; }
+
+        size_t get_tick_count() { return m_tick_count; }
+        double get_sim_time() { return m_sim_time; }
+
+        // The input of the current tick: captured from raylib once per frame, synthesized in
+        // headless mode or read from a replay. Nothing else polls raylib for input.
+        const input_state& get_input() { return m_tick_input; }
+
+        // Input edges latched between ticks. A press is seen by exactly one tick, even when a
+        // frame runs zero or several ticks.
+        bool is_mouse_button_pressed(int button);
+        bool is_key_pressed(int key);
+
+        Vector2 get_mouse_position() { return m_tick_input.mouse_position; }
+        bool is_mouse_button_down(int button) { return (m_tick_input.mouse_buttons_down & (1u << button)) != 0; }
 
         level* get_current_level() { return m_current_level; }
-        void set_next_level(level* next_level) { m_next_level = next_level; }
 
-        button* get_button_in_hand() { return m_button_in_hand; }
-        void set_button_in_hand(button* btn) { m_button_in_hand = btn; }
+        // The class name of the current level, such as 'level_one'.
+        const string& get_current_level_name() { return m_current_level_name; }
+        void set_next_level(level* next_level)
+        {
+            m_next_level = next_level;
+            m_frames_since_level_change = 0;
+        }
+
+        // Abort with a breakdown by phase when a steady-state frame allocates, in builds with
+        // allocation tracking. Frames where a level is built or swapped are not steady state.
+        void set_assert_no_alloc(bool assert_no_alloc) { m_assert_no_alloc = assert_no_alloc; }
+
+        // The button being dragged, or 'nullptr' if there is none or its level has since been
+        // destroyed.
+        button* get_button_in_hand() { return handles->resolve(m_button_in_hand); }
+        void set_button_in_hand(button* btn) { m_button_in_hand = handles->get_handle(btn); }
+
+        // The memory the arenas of levels are carved from. Blocks freed by a destroyed level are
+        // pooled here and reused by the next, so building a level rarely reaches the heap.
+        std::pmr::memory_resource* get_level_memory() { return &m_level_memory; }
 
     private:
         game();
         ~game();
 
+        // Run a single fixed-duration step of the simulation.
+        void tick();
+
+        // Whether 'run()' should return: the tick limit was hit or the replay has ended.
+        bool is_finished();
+
+        // Collect the input raylib reported for this frame, latching its edges. The debug keys
+        // are handled here and never reach the levels or a recording.
+        void latch_input();
+
+        // Generate the input for the next tick in headless mode: the mouse wanders between
+        // random points, and presses and releases the left button at random.
+        void synthesize_input();
+
+        // Step the simulation at the tick rate and draw every frame.
+        void run_windowed();
+
+        // Step the simulation as fast as possible without drawing.
+        void run_headless();
+
+        // Hand the timings of the frame that just ended to the flight recorder and report, and
+        // write the report if a level was swapped out during the frame.
+        void end_frame();
+
+        // Check a finished frame against 'set_assert_no_alloc()'.
+        void check_frame_allocs();
+
+        // Frames after a level change that may still allocate, as the new level settles.
+        static constexpr size_t m_alloc_settle_frames = 1;
+
+        // The key that shows and hides the frame profiler overlay.
+        static constexpr int m_profiler_key = KEY_F3;
+
+        // The key that writes the zones recorded so far to the trace file, in builds with zones.
+        static constexpr int m_trace_key = KEY_F4;
+
         static constexpr const char* m_game_version = "0.0.9";
         static constexpr const char* m_game_name = "Blink's Thinks";
 
@@ -114,16 +230,49 @@ class game
         static constexpr int m_h = 600;
         static constexpr float m_cw = m_w / 2.0f;
         static constexpr float m_ch = m_h / 2.0f;
-        static constexpr size_t m_frame_rate = 60;
+        static constexpr size_t m_default_tick_rate = 60;
+        static constexpr size_t m_default_max_ticks_per_frame = 5;
+
+        // Level arena blocks up to this size are pooled for reuse. Only a couple of levels are
+        // alive at once, so the pool grows a few blocks at a time.
+        static constexpr size_t m_level_memory_largest_block = 256 * 1024;
+        static constexpr size_t m_level_memory_blocks_per_chunk = 4;
+        inline static bool m_headless = false;
 
         level* m_current_level;
         level* m_next_level;
+        string m_current_level_name;
+        size_t m_frames_since_level_change;
+        bool m_assert_no_alloc;
+
+        // Set when a tick swaps out a level, so 'end_frame()' writes the frame report once the
+        // frame is no longer being timed.
+        bool m_report_pending;
+
+        handle<button> m_button_in_hand;
+
+        std::pmr::unsynchronized_pool_resource m_level_memory;
+
+        size_t m_tick_rate;
+        size_t m_max_ticks_per_frame;
+        size_t m_tick_count;
+        size_t m_tick_limit;
+        double m_sim_time;
+
+        // The input the next tick will see, with the edges latched since the last one.
+        input_state m_input;
+
+        // The snapshot of 'm_input' the current tick sees.
+        input_state m_tick_input;
 
-        button* m_button_in_hand;
+        input_log m_input_log;
+        bool m_replay_finished;
 
-        std::default_random_engine m_random_generator;
+        // Separate from the random manager so synthetic input never changes level layouts.
+        std::default_random_engine m_synthetic_input_generator;
+        Vector2 m_synthetic_mouse_target;
 
-        inline static const vector<Color> m_bright_colors =
+        static constexpr std::array<Color, 8> m_bright_colors =
         {
             GOLD, ORANGE, PINK, RED, LIME, SKYBLUE, PURPLE, VIOLET
         };
@@ -106,7 +106,7 @@ class intro_section_one : public engine::level
         void update() override;
 
     private:
-        int m_frames_counter;
+        size_t m_ticks_counter;
 };
 
 class level_one : public engine::level
@@ -157,7 +157,7 @@ class level_five : public engine::level
         void update() override;
 
     private:
-        int m_frames_counter;
+        size_t m_ticks_counter;
 
         string m_duration; 
         button* m_timer;
@@ -171,7 +171,7 @@ class level_six : public engine::level
 
     private:
         static constexpr int m_choice_count = 5, m_min_choice = 1, m_max_choice = 25;  
-        int m_frames_counter;
+        size_t m_ticks_counter;
         button* m_correct_button;
 };
 
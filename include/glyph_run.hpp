@@ -0,0 +1,170 @@
+/***********************************************************************************************
+*
+*   glyph_run.hpp - A line of text decoded and placed once, then drawn glyph by glyph.
+*
+*   Copyright (c) 2025 Josh Hayden (@BlinkDynamo)
+*
+*   Blink's Thinks is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License v3.0 as published
+*   by the Free Software Foundation.
+*
+*   Blink's Thinks is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*
+***********************************************************************************************/
+
+#pragma once
+
+// Raylib.
+#include "raylib.h"
+
+// Standard library.
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace engine
+{
+
+// 'DrawTextPro()' decodes the string and looks up every glyph each time it is called. A run does
+// that once, in 'build()', keeping the atlas rectangle and pen position of every glyph. Drawing
+// it is then one quad per visible glyph. Runs are a single line, placed like 'DrawTextEx()'.
+class glyph_run
+{
+    public:
+        glyph_run();
+
+        // Decode 'text_str' and place its glyphs in 'font' at 'font_size' and 'spacing'. Without a
+        // window the default font has no glyphs loaded, so headless runs are placed from a copy
+        // of its glyph widths, and have nothing to draw. Layouts, and so replays, match between
+        // headless and windowed runs.
+        void build(Font font, const std::string& text_str, float font_size, float spacing);
+
+        size_t size() { return m_glyphs.size(); }
+
+        // The size of the first 'count' glyphs, as 'MeasureTextEx()' would measure them.
+        Vector2 get_size(size_t count = SIZE_MAX);
+
+        // The left edge and advance width of the glyph at 'index'.
+        float get_glyph_x(size_t index) { return m_glyphs[index].pen_x; }
+        float get_glyph_advance(size_t index) { return m_glyphs[index].advance; }
+
+        // Draw 'count' glyphs from 'first', at 'scale' times the size the run was built at. Like
+        // 'DrawTextPro()', 'origin' is the point of the scaled run placed at 'position', and the
+        // run is rotated about it by 'rotation' degrees.
+        void draw(Vector2 position, Vector2 origin, float rotation, float scale, Color tint,
+                  size_t first = 0, size_t count = SIZE_MAX);
+
+    private:
+        friend class glyph_mesh;
+
+        struct glyph
+        {
+            // Where the quad is read from in the font atlas. Spaces and glyphs of headless runs
+            // have no quad, and a width of zero.
+            Rectangle source;
+
+            // Where the quad is drawn, from the top left of the run.
+            Rectangle dest;
+
+            float pen_x;
+            float advance;
+        };
+
+        // Glyph widths of raylib's default font for the printable ASCII characters, at its base
+        // size of 10 pixels.
+        static constexpr int m_default_font_base_size = 10;
+        static constexpr int m_default_font_glyph_widths[] = {
+            3, 1, 4, 6, 5, 7, 6, 2, 3, 3, 5, 5, 2, 4, 1, 7, 5, 2, 5, 5, 5, 5, 5, 5, 5, 5, 1, 1, 3, 4, 3, 6,
+            7, 6, 6, 6, 6, 6, 6, 6, 6, 3, 5, 6, 5, 7, 6, 6, 6, 6, 6, 6, 7, 6, 7, 7, 6, 6, 6, 2, 7, 2, 3, 5,
+            2, 5, 5, 5, 5, 5, 4, 5, 5, 1, 2, 5, 2, 5, 5, 5, 5, 5, 5, 5, 4, 5, 5, 5, 5, 5, 5, 3, 1, 3, 4
+        };
+        static constexpr int m_default_font_first_char = ' ';
+        static constexpr int m_default_font_last_char = '~';
+
+        Font m_font;
+        float m_font_size;
+
+        // Kept between builds, so rebuilding a run no longer than before does not allocate.
+        std::vector<glyph> m_glyphs;
+};
+
+// The quads of a glyph run baked into a vertex buffer, for strings that rarely change. Drawing
+// it submits the buffer at once, placed by a single transform. Only the quads that can reach the
+// viewport are drawn, so a long string mostly off screen costs only the glyphs on it.
+class glyph_mesh
+{
+    public:
+        glyph_mesh();
+        ~glyph_mesh();
+
+        glyph_mesh(const glyph_mesh&) = delete;
+        glyph_mesh& operator=(const glyph_mesh&) = delete;
+
+        // Bake the quads of 'run', in its own space at the size it was built at. The buffer is
+        // only reallocated when the run has more glyphs than it has ever held. Runs with nothing
+        // to draw, such as headless ones, bake nothing. Quads past 'm_max_quads' are left out.
+        void bake(glyph_run& run);
+
+        // The quads of the last bake.
+        size_t size() { return m_quad_count; }
+
+        // Choose the quads that 'draw()' draws with 'transform', and return how many there are.
+        // None are when the transformed bounds of the mesh miss 'viewport'. Otherwise the quads
+        // left and right of the viewport, once it is taken into the mesh's own space, are left
+        // out. A rotated string may keep a few quads just off screen.
+        size_t cull(Matrix transform, Rectangle viewport);
+
+        // Draw the quads chosen by the last 'cull()' with 'material', moved into place by
+        // 'transform'. Anything batched before it is drawn first, so the mesh stays in draw order.
+        void draw(const Material& material, Matrix transform);
+
+    private:
+        // Free the buffers of the mesh, if it has any.
+        void unload();
+
+        // Indices are unsigned shorts, so they only reach the vertices of this many quads.
+        static constexpr size_t m_max_quads = (USHRT_MAX + 1) / 4;
+
+        // Where raylib keeps the index buffer of a mesh, in 'Mesh::vboId'.
+        static constexpr size_t m_index_buffer = 6;
+
+        // The left and right edges of a quad, in the mesh's own space.
+        struct span
+        {
+            float left;
+            float right;
+        };
+
+        Mesh m_mesh;
+
+        // The quads the buffer has room for, and the quads of the last bake.
+        size_t m_capacity;
+        size_t m_quad_count;
+
+        // The edges of every quad, and the rectangle around them all.
+        std::vector<span> m_spans;
+        Rectangle m_bounds;
+
+        // The quads chosen by the last 'cull()'.
+        size_t m_visible_first;
+        size_t m_visible_count;
+
+        // The index buffer holds the indices of the quads from this one on, so drawing from
+        // 'm_visible_first' only uploads them again when it moves. 'SIZE_MAX' when unknown.
+        size_t m_index_shift;
+
+        // Kept for 'UpdateMeshBuffer()', as raylib frees the arrays of a mesh it unloads.
+        std::vector<float> m_vertices;
+        std::vector<float> m_texcoords;
+        std::vector<unsigned short> m_indices;
+};
+
+} // NAMESPACE ENGINE.
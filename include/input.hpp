@@ -0,0 +1,97 @@
+/***********************************************************************************************
+*
+*   input.hpp - The input state seen by each simulation tick, and its recording and replay.
+*
+*   Copyright (c) 2025 Josh Hayden (@BlinkDynamo)
+*
+*   Blink's Thinks is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License v3.0 as published
+*   by the Free Software Foundation.
+*
+*   Blink's Thinks is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*
+***********************************************************************************************/
+
+#pragma once
+
+// Raylib.
+#include "raylib.h"
+
+// Standard library.
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+using std::string;
+
+namespace engine
+{
+
+// The input of one tick. Every entity and level reads the same snapshot through
+// 'game::get_input()', which stays unchanged for the whole tick.
+struct input_state
+{
+    static constexpr size_t max_keys = 16;
+
+    Vector2 mouse_position;
+
+    // Bit 'n' is set for mouse button 'n'.
+    unsigned int mouse_buttons_down;
+    unsigned int mouse_buttons_pressed;
+
+    bool in_canvas;
+
+    // Keys pressed since the last tick, in the order they were pressed.
+    std::array<int, max_keys> keys_pressed;
+    size_t key_count;
+
+    // The tick the snapshot was taken for, and the simulation time at its start. Not recorded,
+    // as a replay counts ticks the same way.
+    size_t tick;
+    double sim_time;
+};
+
+// Records the input of every tick to a compact binary file, or replays such a file in place of
+// live input. Together with the seed and tick rate stored in the header, a replay reproduces
+// the recorded session exactly.
+//
+// File layout (little endian):
+//     header:   "BTIL", u32 version, u32 seed, u32 tick rate
+//     per tick: f32 mouse x, f32 mouse y, u8 buttons down, u8 buttons pressed, u8 in canvas,
+//               u8 key count, then u16 per key pressed
+class input_log
+{
+    public:
+        bool start_recording(const string& path, unsigned int seed, size_t tick_rate);
+        bool start_replay(const string& path);
+
+        bool is_recording() { return m_out.is_open(); }
+        bool is_replaying() { return m_in.is_open(); }
+
+        unsigned int get_seed() { return m_seed; }
+        size_t get_tick_rate() { return m_tick_rate; }
+
+        void write(const input_state& input);
+
+        // Read the next tick's input. Returns false once the log is exhausted.
+        bool read(input_state& input);
+
+    private:
+        static constexpr char m_magic[4] = {'B', 'T', 'I', 'L'};
+        static constexpr uint32_t m_version = 1;
+
+        std::ofstream m_out;
+        std::ifstream m_in;
+
+        unsigned int m_seed = 0;
+        size_t m_tick_rate = 0;
+};
+
+} // NAMESPACE ENGINE.
@@ -0,0 +1,78 @@
+/***********************************************************************************************
+*
+*   kinematics.hpp - Struct-of-arrays storage and integration of entity motion.
+*
+*   Copyright (c) 2025 Josh Hayden (@BlinkDynamo)
+*
+*   Blink's Thinks is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License v3.0 as published
+*   by the Free Software Foundation.
+*
+*   Blink's Thinks is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*
+***********************************************************************************************/
+
+#pragma once
+
+// Raylib.
+#include "raylib.h"
+
+// Standard library.
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+namespace engine
+{
+
+// The positions and speeds of a level's entities, one contiguous array per component, so a
+// tick's motion is integrated for every entity in one SIMD pass instead of one virtual call
+// per entity. Entities index into it by the slot returned from 'add()'.
+class kinematics
+{
+    public:
+        // The arrays are allocated from 'resource', which is the level's arena.
+        explicit kinematics(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+        size_t add(Vector2 position, Vector2 prev_position, Vector2 speed);
+
+        Vector2 get_position(size_t slot) { return {m_x[slot], m_y[slot]}; }
+        void set_position(size_t slot, Vector2 position)
+        {
+            m_x[slot] = position.x;
+            m_y[slot] = position.y;
+        }
+
+        Vector2 get_prev_position(size_t slot) { return {m_prev_x[slot], m_prev_y[slot]}; }
+
+        Vector2 get_speed(size_t slot) { return {m_speed_x[slot], m_speed_y[slot]}; }
+        void set_speed(size_t slot, Vector2 speed)
+        {
+            m_speed_x[slot] = speed.x;
+            m_speed_y[slot] = speed.y;
+        }
+
+        // Remember every position as the previous tick's.
+        void save_state();
+
+        // Move every position by its speed.
+        void integrate();
+
+        size_t size() { return m_x.size(); }
+
+    private:
+        std::pmr::vector<float> m_x;
+        std::pmr::vector<float> m_y;
+        std::pmr::vector<float> m_prev_x;
+        std::pmr::vector<float> m_prev_y;
+        std::pmr::vector<float> m_speed_x;
+        std::pmr::vector<float> m_speed_y;
+};
+
+} // NAMESPACE ENGINE.
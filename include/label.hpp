@@ -26,7 +26,7 @@
 namespace engine
 {
 
-class label : public entity
+class label final : public entity
 {
     public:
         label(
@@ -38,9 +38,15 @@ class label : public entity
             int layer = 0);
 
         void update() override;
-        void draw() override;
+        void draw(float alpha) override;
+        void save_state() override;
+        bool is_resting() override { return is_still() && m_scale == m_prev_scale; }
 
-        void set_scale(float scale) { m_scale = scale; }
+        void set_scale(float scale)
+        {
+            m_scale = scale;
+            wake();
+        }
 
         Rectangle get_rectangle() { return m_rectangle; }
 
@@ -56,6 +62,8 @@ class label : public entity
         Rectangle m_rectangle;
 
         float m_scale;
+
+        float m_prev_scale;
 };
 
 } // NAMESPACE ENGINE.
@@ -22,6 +22,9 @@
 
 // Source.
 #include "entity.hpp"
+#include "entity_layers.hpp"
+#include "entity_types.hpp"
+#include "spatial_grid.hpp"
 #include "animation.hpp"
 #include "background.hpp"
 #include "overlay.hpp"
@@ -32,6 +35,7 @@
 using engine::text;
 
 // Standard library.
+#include <memory_resource>
 #include <string>
 #include <vector>
 #include <type_traits>
@@ -54,23 +58,47 @@ class level
 
         virtual void update();
 
-        virtual void draw();
+        virtual void draw(float alpha);
 
-        vector<button*> get_buttons() { return m_buttons; }
+        const std::pmr::vector<button*>& get_buttons() { return m_buttons; }
+
+        // The topmost button under the mouse this tick, if any, and the same button if the left
+        // mouse button was also pressed this tick.
+        button* get_hovered_button() { return m_hovered_button; }
+        button* get_pressed_button();
+
+        // Call 'fn' with every button whose scaled rectangle overlaps 'rec'. Buttons are kept in
+        // a spatial grid, so only those near 'rec' are tested.
+        template <typename F>
+        void for_each_button_in(Rectangle rec, F&& fn)
+        {
+            m_button_grid.query_rect(rec, [&fn](entity* ent) { fn(static_cast<button*>(ent)); });
+        }
+
+        // Call 'fn' with every pair of buttons whose scaled rectangles overlap.
+        template <typename F>
+        void for_each_overlapping_buttons(F&& fn)
+        {
+            m_button_grid.for_each_pair([&fn](entity* a, entity* b) {
+                fn(static_cast<button*>(a), static_cast<button*>(b));
+            });
+        }
+
+        size_t get_entity_count() { return m_entities.size(); }
+        size_t get_awake_entity_count() { return m_entities.awake_size(); }
+        size_t get_button_count() { return m_buttons.size(); }
 
         template <typename T>
         T* add_entity(T* ent)
         {
             static_assert(is_base_of<entity, T>::value, "T must derive from entity.");
+            static_assert(entity_types::contains<T>, "T must be listed in 'entity_types'.");
 
-            auto it = m_entities.begin();
-            while (it != m_entities.end() && (*it)->get_layer() <= ent->get_layer()) {
-                ++it;
-            }
-            m_entities.insert(it, ent);
+            add_to_level(ent, entity_types::index_of<T>());
 
             if constexpr (is_base_of<button, T>::value) {
                 m_buttons.push_back(static_cast<button*>(ent));
+                m_button_grid.place(ent, ent->get_scaled_rec());
             }
 
             return ent;
@@ -86,10 +114,34 @@ class level
     protected:
         game& m_game;
 
+        // Every entity and button trait of the level is created here, as
+        // 'new (m_arena) T(...)', along with the level's entity containers. All of it is
+        // released in one go when the level is destroyed.
+        std::pmr::monotonic_buffer_resource m_arena;
+
     private:
-        vector<entity*> m_entities;
+        // Place a new entity in the level's containers and give it a handle. 'type' is the
+        // index of its class in 'entity_types'.
+        void add_to_level(entity* ent, size_t type);
+
+        // Find the topmost button under the mouse, and tell it and the button hovered before
+        // it when that changes. Run once per tick, before the entities are updated.
+        void resolve_hover();
+
+        // Most levels fit in the first block. Larger ones grow the arena geometrically.
+        static constexpr size_t m_arena_initial_size = 16 * 1024;
+
+        entity_layers m_entities;
+
+        std::pmr::vector<button*> m_buttons;
+
+        // The scaled rectangles of 'm_buttons', refreshed whenever a button is updated.
+        spatial_grid m_button_grid;
+
+        button* m_hovered_button;
 
-        vector<button*> m_buttons;
+        // The positions and speeds of every entity in 'm_entities'.
+        kinematics m_kinematics;
 };
 
 } // NAMESPACE ENGINE.
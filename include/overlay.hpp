@@ -26,7 +26,7 @@
 namespace engine
 {
 
-class overlay : public entity
+class overlay final : public entity
 {
     public:
         overlay(Color color, Vector2 position = {0, 0}, int layer = 1000);
@@ -34,7 +34,8 @@ class overlay : public entity
         void set_color(Color color) { m_color = color; }
 
         void update() override;
-        void draw() override;
+        void draw(float alpha) override;
+        bool is_resting() override { return is_still(); }
 
     private:
         Color m_color;
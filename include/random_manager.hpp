@@ -0,0 +1,105 @@
+/***********************************************************************************************
+*
+*   random_manager.hpp - Seedable random number streams for the game engine.
+*
+*   Copyright (c) 2025 Josh Hayden (@BlinkDynamo)
+*
+*   Blink's Thinks is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License v3.0 as published
+*   by the Free Software Foundation.
+*
+*   Blink's Thinks is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*
+***********************************************************************************************/
+
+#pragma once
+
+// Standard library.
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+#include <span>
+#include <utility>
+
+namespace engine
+{
+
+class random_manager
+{
+    public:
+        // Independent streams, so drawing more colors never changes a level's layout.
+        enum class stream {
+            LAYOUT,
+            COLORS,
+            EFFECTS,
+            COUNT
+        };
+
+        random_manager(uint32_t seed);
+
+        uint32_t get_seed() { return m_seed; }
+
+        // Reseed every stream and restart the level count.
+        void set_seed(uint32_t seed);
+
+        // Derive fresh streams from the seed and the number of levels begun so far. Each level
+        // calls this on construction, so its numbers don't depend on how many numbers earlier
+        // levels drew.
+        void begin_level();
+
+        // A uniform value in [min, max].
+        int get_value(stream s, int min, int max);
+
+        // Fill 'out' with distinct values in [min, max], excluding 'exclude', in random order.
+        // Uses Floyd's algorithm, so nothing is allocated.
+        void get_sequence(stream s, std::span<int> out, int min, int max,
+                          std::initializer_list<int> exclude = {});
+
+        // Fisher-Yates shuffle 'values' in place.
+        template <typename T>
+        void shuffle(stream s, std::span<T> values)
+        {
+            for (size_t i = values.size(); i > 1; --i) {
+                std::swap(values[i - 1], values[get_bounded(s, i)]);
+            }
+        }
+
+        // Move a random selection of 'values' into its first 'count' elements.
+        template <typename T>
+        void partial_shuffle(stream s, std::span<T> values, size_t count)
+        {
+            for (size_t i = 0; i < count && i < values.size(); ++i) {
+                std::swap(values[i], values[i + get_bounded(s, values.size() - i)]);
+            }
+        }
+
+    private:
+        // PCG32 (O'Neill, pcg-random.org). Unlike the standard engines and distributions its
+        // output is identical on every compiler and platform, which replays rely on.
+        struct generator
+        {
+            uint64_t state;
+            uint64_t increment;
+
+            uint32_t next();
+        };
+
+        // A uniform value in [0, range), by Lemire's multiply-and-reject method.
+        uint32_t get_bounded(stream s, uint64_t range);
+
+        static uint64_t split_mix(uint64_t& state);
+
+        void derive_streams();
+
+        uint32_t m_seed;
+        uint32_t m_level_index;
+        std::array<generator, static_cast<size_t>(stream::COUNT)> m_streams;
+};
+
+} // NAMESPACE ENGINE.
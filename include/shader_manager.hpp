@@ -35,7 +35,9 @@ namespace engine
 class shader_manager
 {
     public:
-        shader_manager();
+        // A headless shader manager loads no render targets or shaders, and every call on it
+        // does nothing.
+        shader_manager(bool headless = false);
         ~shader_manager();
 
         void begin();
@@ -48,6 +50,7 @@ class shader_manager
         unordered_map<string, Shader> m_shaders;
         vector<string> m_shader_queue;
         bool m_in_texture_mode;
+        bool m_headless;
 };
 
 } // NAMESPACE ENGINE.
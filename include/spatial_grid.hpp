@@ -0,0 +1,150 @@
+/***********************************************************************************************
+*
+*   spatial_grid.hpp - A uniform grid over the canvas for finding entities by position.
+*
+*   Copyright (c) 2025 Josh Hayden (@BlinkDynamo)
+*
+*   Blink's Thinks is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License v3.0 as published
+*   by the Free Software Foundation.
+*
+*   Blink's Thinks is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*
+***********************************************************************************************/
+
+#pragma once
+
+// Source.
+#include "entity.hpp"
+
+// Raylib.
+#include "raylib.h"
+
+// Standard library.
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+namespace engine
+{
+
+// Every entity placed in the grid is filed under each cell its rectangle touches, so a lookup
+// only tests the few entities filed near it. Rectangles reaching past the canvas are filed in
+// the cells along its edge. A pair of rectangles sharing several cells is only tested in the
+// first of them, so nothing is reported twice.
+class spatial_grid
+{
+    public:
+        // The cells are allocated from 'resource', which is the level's arena.
+        explicit spatial_grid(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+        // File 'ent' under 'rec', or move it there if it is already in the grid. Moving within
+        // the same cells only stores the new rectangle.
+        void place(entity* ent, Rectangle rec);
+
+        // Call 'fn' with every entity whose rectangle contains 'point', in the order they were
+        // first placed.
+        template <typename F>
+        void query_point(Vector2 point, F&& fn)
+        {
+            const std::pmr::vector<uint32_t>& cell = m_cells[cell_x(point.x) + cell_y(point.y) * m_cols];
+            for (uint32_t slot : cell) {
+                const entry& e = m_entries[slot];
+                if (CheckCollisionPointRec(point, e.rec)) {
+                    fn(e.ent);
+                }
+            }
+        }
+
+        // Call 'fn' with every entity whose rectangle overlaps 'rec', in no particular order.
+        template <typename F>
+        void query_rect(Rectangle rec, F&& fn)
+        {
+            const cell_range cells = cells_of(rec);
+            for (int y = cells.y0; y <= cells.y1; ++y) {
+                for (int x = cells.x0; x <= cells.x1; ++x) {
+                    for (uint32_t slot : m_cells[x + y * m_cols]) {
+                        const entry& e = m_entries[slot];
+                        if (is_first_shared_cell(x, y, cells, e.cells) && CheckCollisionRecs(rec, e.rec)) {
+                            fn(e.ent);
+                        }
+                    }
+                }
+            }
+        }
+
+        // Call 'fn' with every pair of entities whose rectangles overlap, in no particular order.
+        template <typename F>
+        void for_each_pair(F&& fn)
+        {
+            for (int y = 0; y < m_rows; ++y) {
+                for (int x = 0; x < m_cols; ++x) {
+                    const std::pmr::vector<uint32_t>& cell = m_cells[x + y * m_cols];
+                    for (size_t i = 0; i < cell.size(); ++i) {
+                        const entry& a = m_entries[cell[i]];
+                        for (size_t j = i + 1; j < cell.size(); ++j) {
+                            const entry& b = m_entries[cell[j]];
+                            if (is_first_shared_cell(x, y, a.cells, b.cells) && CheckCollisionRecs(a.rec, b.rec)) {
+                                fn(a.ent, b.ent);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        size_t size() { return m_entries.size(); }
+
+        // Forget every entity without touching them, as they may already be destroyed.
+        void clear();
+
+    private:
+        // The cells a rectangle is filed under, inclusive.
+        struct cell_range
+        {
+            int x0, y0, x1, y1;
+            bool operator==(const cell_range&) const = default;
+        };
+
+        struct entry
+        {
+            entity* ent;
+            Rectangle rec;
+            cell_range cells;
+        };
+
+        int cell_x(float x);
+        int cell_y(float y);
+        cell_range cells_of(Rectangle rec);
+
+        // Whether cell ('x', 'y') is the top left cell that both 'a' and 'b' cover.
+        static bool is_first_shared_cell(int x, int y, cell_range a, cell_range b)
+        {
+            return x == std::max(a.x0, b.x0) && y == std::max(a.y0, b.y0);
+        }
+
+        void file(uint32_t slot, cell_range cells);
+        void unfile(uint32_t slot, cell_range cells);
+
+        static constexpr float m_cell_size = 100.0f;
+
+        int m_cols;
+        int m_rows;
+
+        // The entities, indexed by the slot stored in each of them.
+        std::pmr::vector<entry> m_entries;
+
+        // The slots filed under each cell, row by row, sorted so lookups visit them in the
+        // order they were placed.
+        std::pmr::vector<std::pmr::vector<uint32_t>> m_cells;
+};
+
+} // NAMESPACE ENGINE.
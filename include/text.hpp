@@ -22,6 +22,7 @@
 
 // Source.
 #include "entity.hpp"
+#include "glyph_run.hpp"
 
 // Standard library.
 #include <string>
@@ -31,7 +32,7 @@ using std::string;
 namespace engine
 {
 
-class text : public entity
+class text final : public entity
 {
     public:
         text(
@@ -45,17 +46,28 @@ class text : public entity
         );
 
         void update() override;
-        void draw() override;
+        void draw(float alpha) override;
+        void save_state() override;
+        bool is_resting() override;
 
         void add_anim_rotate(float rotation, float speed, float depth)
         {
             m_rotation = rotation;
             m_rotation_speed = speed;
             m_rotation_depth = depth;
+            wake();
         }
 
-        string get_text_str() { return m_text_str; }
-        void set_text_str(string text_str) { m_text_str = text_str; }
+        const string& get_text_str() { return m_text_str; }
+        void set_text_str(const string& text_str)
+        {
+            if (text_str != m_text_str) {
+                m_text_str = text_str;
+                m_run_dirty = true;
+                m_layout_dirty = true;
+                wake();
+            }
+        }
 
         Color get_text_color() { return m_text_color; }
         void set_text_color(Color text_color) { m_text_color = text_color; }
@@ -69,11 +81,31 @@ class text : public entity
         Rectangle get_rec() { return m_rec; }
 
         int get_font_size() { return m_base_font_size; }
-        void set_font_size(int font_size) { m_base_font_size = font_size; }
+        void set_font_size(int font_size)
+        {
+            if (font_size != m_base_font_size) {
+                m_base_font_size = font_size;
+                m_run_dirty = true;
+                m_layout_dirty = true;
+                wake();
+            }
+        }
 
-        void set_scale(float scale) { m_scale = scale; }
+        void set_scale(float scale)
+        {
+            if (scale != m_scale) {
+                m_scale = scale;
+                m_layout_dirty = true;
+                wake();
+            }
+        }
 
     private:
+        // Work out the size of the text from its string, base font size and scale. Only run
+        // when one of those has changed since the last layout. The glyph run is only rebuilt
+        // for a new string or font size, as scaling it needs no new glyphs.
+        void layout();
+
         Font m_font;
 
         string m_text_str;
@@ -82,14 +114,10 @@ class text : public entity
 
         float m_base_font_size;
 
-        float m_scaled_font_size;
-
         Color m_text_color;
 
         Color m_outline_color;
 
-        int m_letter_spacing;
-
         Rectangle m_rec;
 
         Vector2 m_origin;
@@ -101,6 +129,25 @@ class text : public entity
         float m_rotation_speed;
 
         float m_rotation_depth;
+
+        // The scale and rotation of the previous tick, blended with the current ones on draw.
+        float m_prev_scale;
+
+        float m_prev_rotation;
+
+        // The glyphs of 'm_text_str' at the base font size.
+        glyph_run m_run;
+
+        // Whether the string or font size changed since 'm_run' was built.
+        bool m_run_dirty;
+
+        // The quads of 'm_run', baked on the first draw after it is rebuilt.
+        glyph_mesh m_mesh;
+
+        bool m_mesh_dirty;
+
+        // Whether the string, font size or scale changed since the last 'layout()'.
+        bool m_layout_dirty;
 };
 
 } // NAMESPACE ENGINE.
@@ -0,0 +1,126 @@
+/***********************************************************************************************
+*
+*   zone.hpp - Scoped instrumentation zones and their trace-event export.
+*
+*   Copyright (c) 2025 Josh Hayden (@BlinkDynamo)
+*
+*   Blink's Thinks is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License v3.0 as published
+*   by the Free Software Foundation.
+*
+*   Blink's Thinks is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*
+***********************************************************************************************/
+
+#pragma once
+
+// Standard library.
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using std::string;
+using std::vector;
+
+// Zones are compiled out unless the build defines 'GAME_ZONES' ('make linux ZONES=1').
+#ifdef GAME_ZONES
+    #define GAME_ZONE_CONCAT_INNER(a, b) a##b
+    #define GAME_ZONE_CONCAT(a, b) GAME_ZONE_CONCAT_INNER(a, b)
+    #define GAME_ZONE(name) engine::zone_guard GAME_ZONE_CONCAT(game_zone_, __LINE__)(name)
+    #define GAME_ZONE_FUNCTION() GAME_ZONE(__PRETTY_FUNCTION__)
+#else
+    #define GAME_ZONE(name) ((void)0)
+    #define GAME_ZONE_FUNCTION() ((void)0)
+#endif
+
+namespace engine
+{
+
+#ifdef GAME_ZONES
+inline constexpr bool zones_enabled = true;
+#else
+inline constexpr bool zones_enabled = false;
+#endif
+
+// Keeps the most recent zones in a ring and writes them out in the Chrome trace-event format,
+// which opens in 'chrome://tracing' and 'ui.perfetto.dev'.
+class zone_recorder
+{
+    public:
+        using clock = std::chrono::steady_clock;
+
+        static zone_recorder& get_instance()
+        {
+            static zone_recorder instance;
+            return instance;
+        }
+
+        zone_recorder(const zone_recorder&) = delete;
+        zone_recorder& operator=(const zone_recorder&) = delete;
+        zone_recorder(zone_recorder&&) = delete;
+        zone_recorder& operator=(zone_recorder&&) = delete;
+
+        // 'name' must outlive the recorder; zones are named with string literals.
+        void record(const char* name, clock::time_point start, clock::time_point end);
+
+        // Write every zone still in the ring to 'path'. Returns false if the file could not be
+        // opened.
+        bool write(const string& path);
+
+        const string& get_path() { return m_path; }
+        void set_path(const string& path) { m_path = path; }
+
+    private:
+        zone_recorder();
+        ~zone_recorder() = default;
+
+        // Enough for a few minutes of play before the oldest zones are overwritten.
+        static constexpr size_t m_max_events = 1 << 20;
+
+        struct event
+        {
+            const char* name;
+            int64_t start_ns;
+            int64_t duration_ns;
+        };
+
+        vector<event> m_events;
+
+        // The next slot to overwrite once the ring is full.
+        size_t m_next;
+
+        clock::time_point m_origin;
+
+        string m_path;
+};
+
+class zone_guard
+{
+    public:
+        explicit zone_guard(const char* name)
+            :
+            m_name(name),
+            m_start(zone_recorder::clock::now())
+        {}
+
+        ~zone_guard()
+        {
+            zone_recorder::get_instance().record(m_name, m_start, zone_recorder::clock::now());
+        }
+
+        zone_guard(const zone_guard&) = delete;
+        zone_guard& operator=(const zone_guard&) = delete;
+
+    private:
+        const char* m_name;
+        zone_recorder::clock::time_point m_start;
+};
+
+} // NAMESPACE ENGINE.
@@ -0,0 +1,28 @@
+#version 100
+
+precision mediump float;
+
+varying vec2 fragTexCoord;
+varying vec4 fragColor;
+
+uniform sampler2D texture0;
+uniform vec4 colDiffuse;
+
+// The outline, and the softness of edges, in distance field units. An outline width of zero
+// draws the fill alone.
+uniform vec4 outlineColor;
+uniform float outlineWidth;
+uniform float smoothing;
+
+void main() {
+    float dist = texture2D(texture0, fragTexCoord).r;
+
+    float fill = smoothstep(0.5 - smoothing, 0.5 + smoothing, dist);
+    float edge = 0.5 - outlineWidth;
+    float shape = smoothstep(edge - smoothing, edge + smoothing, dist);
+
+    // Meshes carry their fill color in 'colDiffuse', batched quads in their vertices.
+    vec4 fillColor = fragColor * colDiffuse;
+    vec4 color = (outlineWidth > 0.0) ? mix(outlineColor, fillColor, fill) : fillColor;
+    gl_FragColor = vec4(color.rgb, color.a * shape);
+}
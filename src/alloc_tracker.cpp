@@ -0,0 +1,89 @@
+/***********************************************************************************************
+*
+*   alloc_tracker.cpp - Counts the heap allocations made by the game thread.
+*
+*   Copyright (c) 2025 Josh Hayden (@BlinkDynamo)
+*
+*   Blink's Thinks is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License v3.0 as published
+*   by the Free Software Foundation.
+*
+*   Blink's Thinks is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*
+***********************************************************************************************/
+
+// Source.
+#include "alloc_tracker.hpp"
+
+// Standard library.
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    thread_local bool t_tracked = false;
+
+    // Only the tracked thread writes these, so they need no synchronization.
+    engine::alloc_tracker::counts g_counts = {0, 0};
+}
+
+void engine::alloc_tracker::track_this_thread()
+{
+    t_tracked = true;
+}
+
+engine::alloc_tracker::counts engine::alloc_tracker::get_counts()
+{
+    return g_counts;
+}
+
+#ifdef GAME_ALLOC_TRACKING
+
+// The nothrow and array forms of the standard library forward to these, and the aligned forms
+// are left alone; nothing in the game allocates over-aligned types.
+void* operator new(std::size_t size)
+{
+    if (t_tracked) {
+        ++g_counts.allocations;
+        g_counts.bytes += size;
+    }
+
+    void* ptr = std::malloc(size == 0 ? 1 : size);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+#endif
@@ -38,7 +38,7 @@ anim_raylib::anim_raylib()
     m_left_side_rec_height(16),
     m_bottom_side_rec_width(16),
     m_right_side_rec_height(16),
-    m_frame_counter(0),
+    m_tick_counter(0),
     m_letters_count(0),
     m_state(0),
     m_alpha(1.0f)
@@ -70,12 +70,12 @@ void anim_raylib::update()
     switch (m_state)
     {
         case (0): {
-            m_frame_counter++;
+            m_tick_counter++;
 
-            if (m_frame_counter == 120)
+            if (m_tick_counter == 120)
             {
                 m_state = 1;
-                m_frame_counter = 0;      // Reset counter... will be used later...
+                m_tick_counter = 0;      // Reset counter... will be used later...
             }
         } break;
 
@@ -94,12 +94,12 @@ void anim_raylib::update()
         } break;
 
         case (3): { 
-            m_frame_counter++;
+            m_tick_counter++;
 
-            if (m_frame_counter/12)
+            if (m_tick_counter/12)
             {
                 m_letters_count++;
-                m_frame_counter = 0;
+                m_tick_counter = 0;
             }
 
             if (m_letters_count >= 10)
@@ -118,7 +118,7 @@ void anim_raylib::update()
     }
 }
 
-void anim_raylib::draw()
+void anim_raylib::draw(float /* alpha */)
 /***********************************************************************************************
 *
 *   Original animation courtesy of Ramon Santamaria (@raysan5)
@@ -139,7 +139,7 @@ void anim_raylib::draw()
     switch (m_state)
     {
         case (0): {
-            if ((m_frame_counter / 15) % 2) {
+            if ((m_tick_counter / 15) % 2) {
                 DrawRectangle(m_logo_position_x, m_logo_position_y, 16, 16, BLACK);
             }
         } break;
@@ -213,7 +213,7 @@ void anim_raylib::draw()
 anim_self_credit::anim_self_credit()
     : 
     entity({0, 0}, 0), // Both of these are unused. Set default values of 0.
-    m_frame_counter(0),
+    m_tick_counter(0),
     m_letters_count(0),
     m_state(state::LETTERS_ADDING),
     m_text("A game by Josh Hayden"),
@@ -226,8 +226,11 @@ anim_self_credit::anim_self_credit()
         static_cast<float>(game::get_ch())
     }),
 
+    m_run(),
     m_bg_color({ 30, 30, 30, 255})
-{}
+{
+    m_run.build(m_font, m_text, m_font_size, m_spacing);
+}
 
 bool anim_self_credit::is_finished()
 {
@@ -236,35 +239,35 @@ bool anim_self_credit::is_finished()
 
 void anim_self_credit::update()
 { 
-    m_frame_counter++;
+    m_tick_counter++;
 
     switch (m_state)
     {
-        // Letters being added on every 3 frames.
+        // Letters being added on every 3 ticks.
         case state::LETTERS_ADDING: {
-            if (m_letters_count < 21) {
-                if (m_frame_counter / 3) {
+            if (m_letters_count < static_cast<int>(m_run.size())) {
+                if (m_tick_counter / 3) {
                     m_letters_count++;
-                    m_frame_counter = 0;
+                    m_tick_counter = 0;
                 }
             }
             // If done spelling, wait for 1 second, then move to m_state 1.
-            else if (m_frame_counter / 60) {  
+            else if (m_tick_counter / game::get_instance().get_tick_rate()) {
                     m_state = state::LETTERS_REMOVING; 
-                    m_frame_counter = 0;
+                    m_tick_counter = 0;
             }
         } break;
 
-        // Letters being removed on every 3 frames.
+        // Letters being removed on every 3 ticks.
         case state::LETTERS_REMOVING: {
             if (m_letters_count > 0) {
-                if (m_frame_counter / 3) {
+                if (m_tick_counter / 3) {
                     m_letters_count--;
-                    m_frame_counter = 0;
+                    m_tick_counter = 0;
                 }
             }
             // If done removing letters, wait for 1 second, then move to m_state 2.
-            else if (m_frame_counter / 60) {
+            else if (m_tick_counter / game::get_instance().get_tick_rate()) {
                     m_state = state::CURSOR_BLINKING; 
             }
         } break;
@@ -281,7 +284,7 @@ void anim_self_credit::update()
     }
 }
 
-void anim_self_credit::draw()
+void anim_self_credit::draw(float /* alpha */)
 { 
     // draw a background rectangle.
     DrawRectangle(game::get_cw() - 300, game::get_ch() - 30, 600, 100, m_bg_color);
@@ -290,32 +293,24 @@ void anim_self_credit::draw()
         // Letters being added on every 2 frames.
         case state::LETTERS_ADDING: 
         case state::LETTERS_REMOVING: { 
-            float x = m_text_position.x;
-            float y = m_text_position.y;
+            if (m_letters_count == 0) {
+                break;
+            }
 
-            // draw every character in 'text' sequentially, drawing a terminal cursor on the
+            // draw the letters revealed so far from the run, drawing a terminal cursor on the
             // last letter.
-            for (int i = 0; i < m_letters_count; i++) {
-                char c = m_text.c_str()[i];
-                char s[2] = { c, '\0' };
-
-                Vector2 char_size = MeasureTextEx(m_font, s, m_font_size, m_spacing);
-
-                bool is_last = (i == m_letters_count - 1);
-
-                if (is_last) {
-                    DrawRectangle(
-                        static_cast<int>(x), 
-                        static_cast<int>(y), 
-                        static_cast<int>(char_size.x), 
-                        m_font_size, 
-                        DARKBLUE
-                    );
-                }
+            const size_t last = m_letters_count - 1;
+            m_run.draw(m_text_position, { 0, 0 }, 0.0f, 1.0f, SKYBLUE, 0, last);
 
-                DrawTextEx(m_font, s, { x, y }, m_font_size, m_spacing, is_last ? WHITE : SKYBLUE);
-                x += char_size.x + m_spacing;
-            }
+            DrawRectangle(
+                static_cast<int>(m_text_position.x + m_run.get_glyph_x(last)),
+                static_cast<int>(m_text_position.y),
+                static_cast<int>(m_run.get_glyph_advance(last)),
+                m_font_size,
+                DARKBLUE
+            );
+
+            m_run.draw(m_text_position, { 0, 0 }, 0.0f, 1.0f, WHITE, last, 1);
         } break;
 
         case state::CURSOR_BLINKING:
@@ -20,36 +20,74 @@
 
 // Source.
 #include "audio_manager.hpp"
+#include "zone.hpp"
 
 using engine::audio_manager;
 
-audio_manager::audio_manager()
+namespace
 {
-    InitAudioDevice();
-    SetAudioStreamBufferSizeDefault(16384);
+    struct music_file
+    {
+        const char* name;
+        const char* path;
+    };
+
+    struct sound_file
+    {
+        const char* name;
+        const char* path;
+        float volume;
+    };
+
+    // Every track and sound the game plays, by the name it is looked up with.
+    constexpr music_file music_files[] = {
+        { "title_theme", "res/music/title_theme.ogg" },
+        { "win_theme", "res/music/win_theme.ogg" },
+        { "no_stopping_now", "res/music/no_stopping_now.ogg" }
+    };
+
+    constexpr sound_file sound_files[] = {
+        { "click", "res/sfx/click.ogg", 0.22f },
+        { "grab", "res/sfx/grab.ogg", 0.40f }
+    };
+}
 
+audio_manager::audio_manager(bool headless)
+{
     m_current_music = nullptr;
     m_next_music = nullptr;
     m_current_pitch = 1.0f;
     m_next_pitch = 1.0f;
-    m_frame_count_mix = 0;
-    m_frame_count_pitch = 0;
+    m_tick_count_mix = 0;
+    m_tick_count_pitch = 0;
     m_mixing = false;
     m_shifting = false;
+    m_headless = headless;
 
-    m_music_tracks.emplace("title_theme", LoadMusicStream("res/music/title_theme.ogg"));
-    m_music_tracks.emplace("win_theme", LoadMusicStream("res/music/win_theme.ogg"));
-    m_music_tracks.emplace("no_stopping_now", LoadMusicStream("res/music/no_stopping_now.ogg"));
+    if (!m_headless) {
+        InitAudioDevice();
+        SetAudioStreamBufferSizeDefault(16384);
+    }
 
-    m_sound_effects.emplace("click", LoadSound("res/sfx/click.ogg"));
-    SetSoundVolume(m_sound_effects.at("click"), 0.22f);
+    // Headless, every name gets an empty entry instead of a file, so lookups still succeed.
+    for (const music_file& file : music_files) {
+        m_music_tracks.emplace(file.name, m_headless ? Music{} : LoadMusicStream(file.path));
+    }
 
-    m_sound_effects.emplace("grab", LoadSound("res/sfx/grab.ogg"));
-    SetSoundVolume(m_sound_effects.at("grab"), 0.40f);
+    for (const sound_file& file : sound_files) {
+        Sound sound = {};
+        if (!m_headless) {
+            sound = LoadSound(file.path);
+            SetSoundVolume(sound, file.volume);
+        }
+        m_sound_effects.emplace(file.name, sound);
+    }
 }
 
 audio_manager::~audio_manager()
 {
+    if (m_headless) return;
+
     for (const auto& [name, music] : m_music_tracks) {
         UnloadMusicStream(music);
     }
@@ -63,13 +101,17 @@ audio_manager::~audio_manager()
 
 void audio_manager::update()
 {
+    GAME_ZONE_FUNCTION();
+
+    if (m_headless) return;
+
     if (m_mixing) {
 
         // Fade out the current track.
         if (m_current_music != nullptr) {
             SetMusicVolume(
                 *m_current_music,
-                (m_frame_dur_mix - m_frame_count_mix) / static_cast<float>(m_frame_dur_mix)
+                (m_tick_dur_mix - m_tick_count_mix) / static_cast<float>(m_tick_dur_mix)
             );
         }
         
@@ -77,14 +119,14 @@ void audio_manager::update()
         if (m_next_music != nullptr) {
             SetMusicVolume(
                 *m_next_music,
-                m_frame_count_mix / static_cast<float>(m_frame_dur_mix)
+                m_tick_count_mix / static_cast<float>(m_tick_dur_mix)
             );
         }
-        ++m_frame_count_mix;
+        ++m_tick_count_mix;
 
-        // If the frame count has exceeded the duration, stop the current music (mixed out track)
+        // If the tick count has exceeded the duration, stop the current music (mixed out track)
         // and set the current music to the next music. Mixing complete.
-        if (m_frame_count_mix > m_frame_dur_mix) {
+        if (m_tick_count_mix > m_tick_dur_mix) {
             if (m_current_music != nullptr) { StopMusicStream(*m_current_music); }
             m_current_music = m_next_music;
             m_mixing = false;
@@ -92,7 +134,7 @@ void audio_manager::update()
     } 
 
     if (m_shifting) { 
-        float t = m_frame_count_pitch / static_cast<float>(m_frame_dur_pitch);
+        float t = m_tick_count_pitch / static_cast<float>(m_tick_dur_pitch);
         float new_pitch = m_current_pitch + t * (m_next_pitch - m_current_pitch);
 
         if (m_current_music != nullptr) {
@@ -103,9 +145,9 @@ void audio_manager::update()
             SetMusicPitch(*m_next_music, new_pitch);
         }
 
-        ++m_frame_count_pitch;
+        ++m_tick_count_pitch;
 
-        if (m_frame_count_pitch > m_frame_dur_pitch) {
+        if (m_tick_count_pitch > m_tick_dur_pitch) {
             m_current_pitch = m_next_pitch;
             m_shifting = false;
         }
@@ -121,8 +163,17 @@ void audio_manager::update()
     }
 } 
 
+void audio_manager::play_sound(Sound sound)
+{
+    if (m_headless) return;
+
+    PlaySound(sound);
+}
+
 void audio_manager::set_next_music(string track_name, bool looping)
 {
+    if (m_headless) return;
+
     Music* next_music = &m_music_tracks.at(track_name);
  
     if (next_music == m_current_music) {
@@ -137,7 +188,7 @@ void audio_manager::set_next_music(string track_name, bool looping)
     next_music->looping = looping;
   
     m_mixing = true;
-    m_frame_count_mix = 0;
+    m_tick_count_mix = 0;
     m_next_music = next_music;
     PlayMusicStream(*m_next_music);
     SetMusicVolume(*m_next_music, 0.0f);
@@ -145,9 +196,9 @@ void audio_manager::set_next_music(string track_name, bool looping)
 
 void audio_manager::shift_pitch(float pitch)
 {
-    if (m_current_music == nullptr) return;
+    if (m_headless || m_current_music == nullptr) return;
 
     m_next_pitch = pitch;
-    m_frame_count_pitch = 0;
+    m_tick_count_pitch = 0;
     m_shifting = true;
 }
@@ -21,6 +21,7 @@
 // Source.
 #include "game.hpp"
 #include "background.hpp"
+#include "zone.hpp"
 
 // Standard library.
 #include <cmath>
@@ -28,8 +29,10 @@
 // Source.
 using engine::background;
 using engine::game;
+using engine::frame_profiler;
 
 float background::m_scroll_offset = 0.0f;
+float background::m_prev_scroll_offset = 0.0f;
 
 background::background(
     Color dark_color,
@@ -47,17 +50,21 @@ background::~background()
 
 void background::update()
 {
-    set_scroll_offset(get_scroll_offset() + GetFrameTime() * 30.0f);
+    set_scroll_offset(get_scroll_offset() + 30.0f / game::get_instance().get_tick_rate());
 }
 
-void background::draw()
+void background::draw(float alpha)
 {
+    GAME_ZONE_FUNCTION();
+
     const int cols = (game::get_w() / m_square_size) + 2;
     const int rows = (game::get_h() / m_square_size) + 2;
 
-    const float effective_offset = std::fmod(get_scroll_offset(), 2 * m_square_size);
+    const float scroll_offset = lerp(m_prev_scroll_offset, get_scroll_offset(), alpha);
+    const float effective_offset = std::fmod(scroll_offset, 2 * m_square_size);
 
     game& game_inst = game::get_instance();
+    game_inst.profiler->begin_phase(frame_profiler::phase::BACKGROUND_DRAW);
     game_inst.shaders->begin();
 
     ClearBackground(RAYWHITE);
@@ -75,5 +82,10 @@ void background::draw()
 
     game_inst.shaders->append("blur");
     game_inst.shaders->append("vignette");
+
+    game_inst.profiler->begin_phase(frame_profiler::phase::SHADER_PROCESS);
     game_inst.shaders->process();
+    game_inst.profiler->end_phase(frame_profiler::phase::SHADER_PROCESS);
+
+    game_inst.profiler->end_phase(frame_profiler::phase::BACKGROUND_DRAW);
 }
@@ -21,6 +21,7 @@
 // Source.
 #include "button.hpp"
 #include "game.hpp"
+#include "zone.hpp"
 
 // Standard library.
 #include <cmath>
@@ -47,11 +48,18 @@ button::button(
     m_current_bg_color(m_default_bg_color),
     m_outline_color(outline_color),
     m_outline_size(outline_size),
-    m_scale(1.0f)
+    m_scale(1.0f),
+    m_prev_scale(m_scale),
+    m_hovered(false),
+    m_static_traits{},
+    m_static_trait_count(0)
 {
-    m_text_obj->set_position(m_position);
-    m_rec.x = m_position.x;
-    m_rec.y = m_position.y;
+    m_text_obj->set_owner(this);
+
+    const Vector2 position = get_position();
+    m_text_obj->set_position(position);
+    m_rec.x = position.x;
+    m_rec.y = position.y;
 }
 
 button::~button()
@@ -64,44 +72,49 @@ button::~button()
     m_traits.clear();
 }
 
-bool button::is_hovered()
-{
-    return CheckCollisionPointRec(GetMousePosition(), m_scaled_rec);
-}
-
 bool button::is_pressed()
 {
-    return is_hovered() && IsMouseButtonPressed(0);
+    return m_hovered && game::get_instance().is_mouse_button_pressed(MOUSE_BUTTON_LEFT);
 }
 
 void button::update()
-{ 
+{
+    GAME_ZONE_FUNCTION();
+
     entity::update();
 
+    // Every trait sees the hover state the level resolved from the rectangles of the last tick.
+    const bool hovered = m_hovered;
+
+    for (size_t i = 0; i < m_static_trait_count; ++i) {
+        std::visit([this, hovered](auto& trait) { trait.update(*this, hovered); }, m_static_traits[i]);
+    }
+
     for (auto& trait : m_traits) {
-        trait->update(*this);
+        trait->update(*this, hovered);
     }
 
+    const Vector2 position = get_position();
     m_scaled_rec = {
-        m_position.x - ((m_rec.width * m_scale) / 2.0f),
-        m_position.y - ((m_rec.height * m_scale) / 2.0f),
+        position.x - ((m_rec.width * m_scale) / 2.0f),
+        position.y - ((m_rec.height * m_scale) / 2.0f),
         m_rec.width * m_scale,
         m_rec.height * m_scale
     };
 
     m_text_obj->set_scale(m_scale);
-    m_text_obj->set_position(m_position);
+    m_text_obj->set_position(position);
 
-    m_current_text_color = is_hovered()
+    m_current_text_color = hovered
         ? brighten_color(m_default_text_color)
         : m_default_text_color;
 
-    m_current_bg_color = (is_hovered() && m_default_bg_color.a != 0)
+    m_current_bg_color = (hovered && m_default_bg_color.a != 0)
         ? brighten_color(m_default_bg_color)
         : m_default_bg_color;
 
     if (is_pressed() && m_sfx_press.has_value()) {
-        PlaySound(*m_sfx_press);
+        game::get_instance().audio->play_sound(*m_sfx_press);
     }
 
     m_text_obj->set_text_color(m_current_text_color); 
@@ -109,11 +122,56 @@ void button::update()
     m_text_obj->update(); 
 }
 
-void button::draw()
+void button::add_trait(static_trait trait)
+{
+    GAME_ASSERT(m_static_trait_count < m_max_static_traits, "Too many static traits on one button.");
+    m_static_traits[m_static_trait_count++] = std::move(trait);
+    wake();
+}
+
+bool button::is_resting()
+{
+    if (m_hovered || !is_still() || m_scale != m_prev_scale || !m_text_obj->is_resting()) {
+        return false;
+    }
+
+    for (size_t i = 0; i < m_static_trait_count; ++i) {
+        if (!std::visit([](auto& trait) { return trait.is_resting(); }, m_static_traits[i])) {
+            return false;
+        }
+    }
+
+    for (button_trait* trait : m_traits) {
+        if (!trait->is_resting()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void button::save_state()
+{
+    entity::save_state();
+    m_prev_scale = m_scale;
+    m_text_obj->save_state();
+}
+
+void button::draw(float alpha)
 {
-    DrawRectangleRec(m_scaled_rec, m_current_bg_color);
-    DrawRectangleLinesEx(m_scaled_rec, m_outline_size, m_outline_color);
-    m_text_obj->draw();
+    // Blend the scaled rectangle between the previous and current tick.
+    const Vector2 position = get_render_position(alpha);
+    const float scale = lerp(m_prev_scale, m_scale, alpha);
+    const Rectangle scaled_rec = {
+        position.x - ((m_rec.width * scale) / 2.0f),
+        position.y - ((m_rec.height * scale) / 2.0f),
+        m_rec.width * scale,
+        m_rec.height * scale
+    };
+
+    DrawRectangleRec(scaled_rec, m_current_bg_color);
+    DrawRectangleLinesEx(scaled_rec, m_outline_size, m_outline_color);
+    m_text_obj->draw(alpha);
 }
 
 Color button::brighten_color(Color color)
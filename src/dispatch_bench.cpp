@@ -0,0 +1,173 @@
+/***********************************************************************************************
+*
+*   dispatch_bench.cpp - A benchmark of the per-entity update and draw dispatch.
+*
+*   Copyright (c) 2025 Josh Hayden (@BlinkDynamo)
+*
+*   Blink's Thinks is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License v3.0 as published
+*   by the Free Software Foundation.
+*
+*   Blink's Thinks is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*
+***********************************************************************************************/
+
+// Source.
+#include "dispatch_bench.hpp"
+#include "game.hpp"
+#include "entity_layers.hpp"
+#include "kinematics.hpp"
+
+// Raylib.
+#include "raylib.h"
+
+// Standard library.
+#include <chrono>
+#include <memory_resource>
+
+using engine::game;
+using engine::entity;
+using engine::entity_layers;
+using engine::entity_types;
+using engine::kinematics;
+using engine::text;
+using engine::button;
+using engine::label;
+using engine::grows_when_hovered;
+
+namespace
+{
+
+template <typename F>
+double time_ms(F&& fn)
+{
+    const auto start_time = std::chrono::steady_clock::now();
+    fn();
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start_time;
+    return elapsed.count();
+}
+
+template <typename T>
+void add(entity_layers& layers, kinematics& store, std::pmr::vector<entity*>& created, T* ent)
+{
+    ent->attach(store);
+    layers.add(ent, entity_types::index_of<T>());
+    created.push_back(ent);
+}
+
+} // NAMESPACE.
+
+void engine::run_dispatch_bench(size_t entity_count, size_t rounds)
+{
+    game& game_inst = game::get_instance();
+
+    std::pmr::monotonic_buffer_resource arena(game_inst.get_level_memory());
+    entity_layers layers(&arena);
+    kinematics store(&arena);
+
+    // The entities in the order they were created, which is how levels kept them before they
+    // were batched: one mixed list, visited with a virtual call per entity. Interleaved, so that
+    // list meets a different class on every entity.
+    std::pmr::vector<entity*> created(&arena);
+    created.reserve(entity_count);
+
+    for (size_t i = 0; i < entity_count; ++i) {
+        const Vector2 position = {
+            static_cast<float>((i * 37) % game::get_w()),
+            static_cast<float>((i * 53) % game::get_h())
+        };
+        const int layer = static_cast<int>(i / 3 % 4);
+
+        switch (i % 3) {
+            case 0:
+                add(layers, store, created, new (arena) text("bench", 40, RAYWHITE, position, layer));
+                break;
+            case 1: {
+                button* const btn = new (arena) button(
+                    new (arena) text("0", 80, ORANGE, position, layer),
+                    DARKGRAY,
+                    {position.x - 40.0f, position.y - 40.0f, 80.0f, 80.0f},
+                    layer
+                );
+                btn->add_trait(grows_when_hovered());
+                add(layers, store, created, btn);
+                break;
+            }
+            default:
+                add(layers, store, created, new (arena) label(BLACK, WHITE, {80, 60}, 4, position, layer));
+                break;
+        }
+    }
+
+    double virtual_update_ms = 0.0;
+    double typed_update_ms = 0.0;
+    double virtual_draw_ms = 0.0;
+    double typed_draw_ms = 0.0;
+
+    for (size_t round = 0; round < rounds; ++round) {
+        virtual_update_ms += time_ms([&created] {
+            for (entity* ent : created) {
+                ent->save_state();
+                ent->update();
+            }
+        });
+
+        // Levels update through the per-class awake lists. Every entity is kept awake here.
+        typed_update_ms += time_ms([&layers] {
+            layers.for_each_awake([](auto* ent) {
+                ent->save_state();
+                ent->update();
+                return true;
+            });
+        });
+
+        if (!game::is_headless()) {
+            BeginDrawing();
+            ClearBackground(RAYWHITE);
+            virtual_draw_ms += time_ms([&created] {
+                for (entity* ent : created) {
+                    ent->draw(1.0f);
+                }
+            });
+            // Drawing keeps the order within each layer, where the classes alternate here, so
+            // this times the worst case of runs one entity long.
+            typed_draw_ms += time_ms([&layers] {
+                layers.for_each_typed([](auto* ent) { ent->draw(1.0f); });
+            });
+            EndDrawing();
+        }
+    }
+
+    const double count = static_cast<double>(rounds);
+    TraceLog(
+        LOG_INFO,
+        "[%s] %zu entities, %zu rounds. Update: %.3f ms virtual, %.3f ms batched (%.2fx).",
+        __PRETTY_FUNCTION__,
+        layers.size(),
+        rounds,
+        virtual_update_ms / count,
+        typed_update_ms / count,
+        virtual_update_ms / typed_update_ms
+    );
+    if (!game::is_headless()) {
+        TraceLog(
+            LOG_INFO,
+            "[%s] Draw: %.3f ms virtual, %.3f ms batched (%.2fx).",
+            __PRETTY_FUNCTION__,
+            virtual_draw_ms / count,
+            typed_draw_ms / count,
+            virtual_draw_ms / typed_draw_ms
+        );
+    }
+
+    for (entity* ent : created) {
+        delete ent;
+    }
+    layers.clear();
+}
@@ -20,18 +20,87 @@
 
 // Source.
 #include "entity.hpp"
+#include "entity_layers.hpp"
 
 using engine::entity;
 
 entity::entity(Vector2 position, int layer, Vector2 speed)
     :
-    m_position(position),
     m_layer(layer),
+    m_position(position),
+    m_prev_position(position),
     m_speed(speed)
 {}
 
 void entity::update()
 {
-    // update the position of the entity according to the movement speed.
-    m_position = {m_position.x + m_speed.x, m_position.y + m_speed.y};
+    if (m_kinematics == nullptr) {
+        // update the position of the entity according to the movement speed.
+        m_position = {m_position.x + m_speed.x, m_position.y + m_speed.y};
+    }
+}
+
+void entity::save_state()
+{
+    if (m_kinematics == nullptr) {
+        m_prev_position = m_position;
+    }
+}
+
+void entity::attach(kinematics& store)
+{
+    m_kinematics_slot = store.add(m_position, m_prev_position, m_speed);
+    m_kinematics = &store;
+}
+
+void entity::wake()
+{
+    if (m_owner != nullptr) {
+        m_owner->wake();
+    }
+    else if (m_layers != nullptr) {
+        m_layers->wake(this);
+    }
+}
+
+void entity::set_position(Vector2 position)
+{
+    if (m_kinematics != nullptr) {
+        m_kinematics->set_position(m_kinematics_slot, position);
+    }
+    else {
+        m_position = position;
+    }
+    wake();
+}
+
+void entity::set_speed(Vector2 speed)
+{
+    if (m_kinematics != nullptr) {
+        m_kinematics->set_speed(m_kinematics_slot, speed);
+    }
+    else {
+        m_speed = speed;
+    }
+    wake();
+}
+
+void entity::set_layer(int layer)
+{
+    if (layer == m_layer) {
+        return;
+    }
+
+    m_layer = layer;
+    if (m_layers != nullptr) {
+        m_layers->mark_dirty(this);
+    }
+}
+
+Vector2 entity::get_render_position(float alpha)
+{
+    const Vector2 position = get_position();
+    const Vector2 prev_position =
+        m_kinematics != nullptr ? m_kinematics->get_prev_position(m_kinematics_slot) : m_prev_position;
+    return {lerp(prev_position.x, position.x, alpha), lerp(prev_position.y, position.y, alpha)};
 }
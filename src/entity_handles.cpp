@@ -0,0 +1,58 @@
+/***********************************************************************************************
+*
+*   entity_handles.cpp - Generational handles to entities that may be destroyed.
+*
+*   Copyright (c) 2025 Josh Hayden (@BlinkDynamo)
+*
+*   Blink's Thinks is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License v3.0 as published
+*   by the Free Software Foundation.
+*
+*   Blink's Thinks is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*
+***********************************************************************************************/
+
+// Source.
+#include "entity_handles.hpp"
+#include "game.hpp"
+
+using engine::entity_handles;
+
+void entity_handles::add(entity* ent)
+{
+    GAME_ASSERT(ent->m_handle_index == handle<entity>::m_null_index, "The entity already has a handle.");
+
+    uint32_t index = m_free_head;
+    if (index != handle<entity>::m_null_index) {
+        m_free_head = m_slots[index].next_free;
+    }
+    else {
+        index = static_cast<uint32_t>(m_slots.size());
+        m_slots.push_back({nullptr, 0, handle<entity>::m_null_index});
+    }
+
+    m_slots[index].ent = ent;
+    ent->m_handle_index = index;
+}
+
+void entity_handles::remove(entity* ent)
+{
+    const uint32_t index = ent->m_handle_index;
+    if (index == handle<entity>::m_null_index) {
+        return;
+    }
+
+    slot& s = m_slots[index];
+    s.ent = nullptr;
+    ++s.generation;
+    s.next_free = m_free_head;
+    m_free_head = index;
+
+    ent->m_handle_index = handle<entity>::m_null_index;
+}
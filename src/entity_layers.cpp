@@ -0,0 +1,124 @@
+/***********************************************************************************************
+*
+*   entity_layers.cpp - A level's entities, bucketed by layer in draw order.
+*
+*   Copyright (c) 2025 Josh Hayden (@BlinkDynamo)
+*
+*   Blink's Thinks is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License v3.0 as published
+*   by the Free Software Foundation.
+*
+*   Blink's Thinks is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*
+***********************************************************************************************/
+
+// Source.
+#include "entity_layers.hpp"
+#include "game.hpp"
+
+using engine::entity_layers;
+
+entity_layers::entity_layers(std::pmr::memory_resource* resource)
+    :
+    m_buckets(resource),
+    m_dirty(resource),
+    m_awake_lists(entity_types::size, resource),
+    m_waking(resource)
+{}
+
+void entity_layers::add(entity* ent, size_t type)
+{
+    GAME_ASSERT(ent->m_layers == nullptr, "An entity can only be added to one level.");
+
+    ent->m_layers = this;
+    ent->m_bucket_layer = ent->get_layer();
+    ent->m_bucket_type = type;
+    push_back(ent);
+    ++m_size;
+
+    // Every entity is updated at least once, to lay itself out.
+    ent->m_awake = true;
+    m_awake_lists[type].push_back(ent);
+}
+
+void entity_layers::mark_dirty(entity* ent)
+{
+    if (!ent->m_layer_dirty) {
+        ent->m_layer_dirty = true;
+        m_dirty.push_back(ent);
+    }
+}
+
+void entity_layers::wake(entity* ent)
+{
+    if (!ent->m_awake) {
+        ent->m_awake = true;
+        m_waking.push_back(ent);
+    }
+}
+
+size_t entity_layers::awake_size()
+{
+    size_t count = m_waking.size();
+    for (const std::pmr::vector<entity*>& awake : m_awake_lists) {
+        count += awake.size();
+    }
+    return count;
+}
+
+void entity_layers::rebucket()
+{
+    for (entity* ent : m_dirty) {
+        ent->m_layer_dirty = false;
+
+        const int layer = ent->get_layer();
+        if (layer == ent->m_bucket_layer) {
+            continue;
+        }
+
+        // The entities after it in its old bucket each move down a place.
+        std::pmr::vector<entity*>& old_bucket = m_buckets[ent->m_bucket_layer];
+        old_bucket.erase(old_bucket.begin() + ent->m_bucket_index);
+        for (size_t i = ent->m_bucket_index; i < old_bucket.size(); ++i) {
+            old_bucket[i]->m_bucket_index = i;
+        }
+
+        // Emptied buckets are kept, along with their capacity. Layers are reused, such as
+        // when a grabbed button is dropped back to where it came from.
+        ent->m_bucket_layer = layer;
+        push_back(ent);
+    }
+    m_dirty.clear();
+}
+
+bool entity_layers::is_drawn_above(entity* a, entity* b)
+{
+    if (a->m_bucket_layer != b->m_bucket_layer) {
+        return a->m_bucket_layer > b->m_bucket_layer;
+    }
+    return a->m_bucket_index > b->m_bucket_index;
+}
+
+void entity_layers::push_back(entity* ent)
+{
+    std::pmr::vector<entity*>& bucket = m_buckets[ent->m_bucket_layer];
+    ent->m_bucket_index = bucket.size();
+    bucket.push_back(ent);
+}
+
+void entity_layers::clear()
+{
+    m_buckets.clear();
+    m_dirty.clear();
+    for (std::pmr::vector<entity*>& awake : m_awake_lists) {
+        awake.clear();
+    }
+    m_waking.clear();
+    m_size = 0;
+}
@@ -27,21 +27,22 @@ using engine::button_trait;
 using engine::grows_when_hovered;
 using engine::grabbable;
 
-grows_when_hovered::grows_when_hovered(int frame_duration, float target_scale)
+grows_when_hovered::grows_when_hovered(int tick_duration, float target_scale)
 {
-    this->m_frame_duration = frame_duration;
+    this->m_tick_duration = tick_duration;
     this->m_target_scale = target_scale;
     this->m_default_scale = 1.0f;
+    this->m_current_scale = m_default_scale;
 }
 
-void grows_when_hovered::update(button& btn)
+void grows_when_hovered::update(button& btn, bool hovered)
 {
     m_current_scale = btn.get_scale();
 
-    if (btn.is_hovered()) {
+    if (hovered) {
         if (!game::float_equals(m_current_scale, m_target_scale)) {
-            // Compute per-frame delta.
-            float delta = (m_target_scale - m_current_scale) / m_frame_duration;
+            // Compute per-tick delta.
+            float delta = (m_target_scale - m_current_scale) / m_tick_duration;
             m_current_scale += delta;
 
             // Snap if overshoot.
@@ -52,7 +53,7 @@ void grows_when_hovered::update(button& btn)
         }
     }
     else if (!game::float_equals(m_current_scale, m_default_scale)) {
-        float delta = (m_default_scale - m_current_scale) / m_frame_duration;
+        float delta = (m_default_scale - m_current_scale) / m_tick_duration;
         m_current_scale += delta;
 
         if ((delta > 0 && m_current_scale > m_default_scale) ||
@@ -64,32 +65,40 @@ void grows_when_hovered::update(button& btn)
     btn.set_scale(m_current_scale);
 }
 
+// Buttons do not rest while hovered, so the trait rests once it has shrunk back.
+bool grows_when_hovered::is_resting()
+{
+    return game::float_equals(m_current_scale, m_default_scale);
+}
+
 grabbable::grabbable()
 {
     this->m_is_grabbed = false;
     this->m_grab_offset = {0.0f, 0.0f};
 }
 
-void grabbable::update(button& btn)
+void grabbable::update(button& btn, bool hovered)
 {
-    if (btn.is_hovered() && IsMouseButtonPressed(0)) {
+    game& game_inst = game::get_instance();
+
+    if (hovered && game_inst.is_mouse_button_pressed(MOUSE_BUTTON_LEFT)) {
         m_is_grabbed = true;
-        Vector2 mouse_pos = GetMousePosition();
+        Vector2 mouse_pos = game_inst.get_mouse_position();
         Vector2 button_pos = btn.get_position();
         m_grab_offset = {mouse_pos.x - button_pos.x, mouse_pos.y - button_pos.y};
 
-        game::get_instance().set_button_in_hand(&btn);
+        game_inst.set_button_in_hand(&btn);
         btn.set_layer(100);
     }
 
-    if (m_is_grabbed && IsMouseButtonDown(0)) {
-        Vector2 mouse_pos = GetMousePosition();
+    if (m_is_grabbed && game_inst.is_mouse_button_down(MOUSE_BUTTON_LEFT)) {
+        Vector2 mouse_pos = game_inst.get_mouse_position();
         btn.set_position({mouse_pos.x - m_grab_offset.x, mouse_pos.y - m_grab_offset.y});
     }
 
-    if (!IsMouseButtonDown(0) && m_is_grabbed) {
+    if (!game_inst.is_mouse_button_down(MOUSE_BUTTON_LEFT) && m_is_grabbed) {
         m_is_grabbed = false;
-        game::get_instance().set_button_in_hand(nullptr);
+        game_inst.set_button_in_hand(nullptr);
         btn.set_layer(0);
     }
 }
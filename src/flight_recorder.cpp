@@ -0,0 +1,152 @@
+/***********************************************************************************************
+*
+*   flight_recorder.cpp - An always-on ring of recent frame timings, dumped on budget overruns.
+*
+*   Copyright (c) 2025 Josh Hayden (@BlinkDynamo)
+*
+*   Blink's Thinks is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License v3.0 as published
+*   by the Free Software Foundation.
+*
+*   Blink's Thinks is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*
+***********************************************************************************************/
+
+// Source.
+#include "flight_recorder.hpp"
+
+// Raylib.
+#include "raylib.h"
+
+// Standard library.
+#include <algorithm>
+#include <cstdio>
+
+using engine::flight_recorder;
+
+flight_recorder::flight_recorder(float budget_ms)
+    :
+    m_frames{},
+    m_frame_count(0),
+    m_budget_ms(budget_ms),
+    m_overrun_index(0),
+    m_frames_until_dump(0),
+    m_dump_pending(false),
+    m_dump_count(0),
+    m_dump_prefix("hitch_")
+{}
+
+void flight_recorder::record(
+    const string& level_name,
+    size_t tick_count,
+    const std::array<float, frame_profiler::phase_count>& phase_ms,
+    float frame_ms)
+{
+    const size_t index = m_frame_count.load(std::memory_order_relaxed);
+    frame& slot = m_frames[index % m_frame_capacity];
+
+    slot.index = index;
+    slot.tick_count = tick_count;
+    slot.frame_ms = frame_ms;
+    slot.phase_ms = phase_ms;
+
+    const size_t name_length = std::min(level_name.size(), m_level_name_size - 1);
+    std::copy_n(level_name.begin(), name_length, slot.level_name.begin());
+    slot.level_name[name_length] = '\0';
+
+    m_frame_count.store(index + 1, std::memory_order_release);
+
+    if (m_dump_pending) {
+        if (--m_frames_until_dump == 0) {
+            dump();
+            m_dump_pending = false;
+        }
+        return;
+    }
+
+    const float work_ms = frame_ms - phase_ms[static_cast<size_t>(frame_profiler::phase::PRESENT)];
+
+    if (m_budget_ms > 0.0f && work_ms > m_budget_ms && m_dump_count < m_max_dumps) {
+        m_overrun_index = index;
+        m_frames_until_dump = m_frames_after_overrun;
+        m_dump_pending = true;
+    }
+}
+
+void flight_recorder::flush()
+{
+    if (m_dump_pending) {
+        dump();
+        m_dump_pending = false;
+    }
+}
+
+void flight_recorder::dump()
+{
+    const string path = m_dump_prefix + std::to_string(m_dump_count++) + ".json";
+
+    std::FILE* file = std::fopen(path.c_str(), "w");
+    if (file == nullptr) {
+        TraceLog(LOG_ERROR, "[%s] Could not open '%s' for writing.", __PRETTY_FUNCTION__, path.c_str());
+        return;
+    }
+
+    const size_t frame_count = m_frame_count.load(std::memory_order_acquire);
+    const size_t first = frame_count > m_frame_capacity ? frame_count - m_frame_capacity : 0;
+
+    std::fprintf(
+        file,
+        "{\n\"budget_ms\": %.3f,\n\"overrun_frame\": %zu,\n\"frames\": [\n",
+        m_budget_ms,
+        m_overrun_index
+    );
+
+    for (size_t i = first; i < frame_count; ++i) {
+        const frame& f = m_frames[i % m_frame_capacity];
+
+        // Level names are C++ class names, which never need escaping in JSON.
+        std::fprintf(
+            file,
+            "%s{\"frame\": %zu, \"tick\": %zu, \"level\": \"%s\", \"frame_ms\": %.3f",
+            i == first ? "" : ",\n",
+            f.index,
+            f.tick_count,
+            f.level_name.data(),
+            f.frame_ms
+        );
+
+        for (size_t p = 0; p < frame_profiler::phase_count; ++p) {
+            std::fprintf(
+                file,
+                ", \"%s\": %.3f",
+                frame_profiler::get_phase_name(static_cast<frame_profiler::phase>(p)),
+                f.phase_ms[p]
+            );
+        }
+        std::fputs("}", file);
+    }
+
+    std::fputs("\n]\n}\n", file);
+    std::fclose(file);
+
+    const frame& overrun = m_frames[m_overrun_index % m_frame_capacity];
+    const float overrun_work_ms =
+        overrun.frame_ms - overrun.phase_ms[static_cast<size_t>(frame_profiler::phase::PRESENT)];
+    TraceLog(
+        LOG_WARNING,
+        "[%s] Frame %zu in %s took %.2f ms before present (budget %.2f ms). Wrote the "
+        "surrounding frames to '%s'.",
+        __PRETTY_FUNCTION__,
+        m_overrun_index,
+        overrun.level_name.data(),
+        overrun_work_ms,
+        m_budget_ms,
+        path.c_str()
+    );
+}
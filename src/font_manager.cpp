@@ -0,0 +1,246 @@
+/***********************************************************************************************
+*
+*   font_manager.cpp - The distance field text font and the shader that draws it.
+*
+*   Copyright (c) 2025 Josh Hayden (@BlinkDynamo)
+*
+*   Blink's Thinks is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License v3.0 as published
+*   by the Free Software Foundation.
+*
+*   Blink's Thinks is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*
+***********************************************************************************************/
+
+// Source.
+#include "font_manager.hpp"
+#include "game.hpp"
+
+// Standard library.
+#include <algorithm>
+#include <cmath>
+
+using engine::font_manager;
+using engine::game;
+
+namespace
+{
+    constexpr float far_away = 1e20f;
+
+    // The squared distance transform of one row or column (Felzenszwalb and Huttenlocher).
+    // 'v' and 'z' are scratch space of 'n' and 'n + 1' values.
+    void distance_transform_1d(const float* f, float* d, int n, int* v, float* z)
+    {
+        int k = 0;
+        v[0] = 0;
+        z[0] = -far_away;
+        z[1] = far_away;
+
+        for (int q = 1; q < n; ++q) {
+            float s = ((f[q] + q * q) - (f[v[k]] + v[k] * v[k])) / (2.0f * (q - v[k]));
+            while (s <= z[k]) {
+                --k;
+                s = ((f[q] + q * q) - (f[v[k]] + v[k] * v[k])) / (2.0f * (q - v[k]));
+            }
+            ++k;
+            v[k] = q;
+            z[k] = s;
+            z[k + 1] = far_away;
+        }
+
+        k = 0;
+        for (int q = 0; q < n; ++q) {
+            while (z[k + 1] < q) {
+                ++k;
+            }
+            d[q] = (q - v[k]) * (q - v[k]) + f[v[k]];
+        }
+    }
+
+    // The squared distance from every pixel of a 'w' by 'h' image to the nearest pixel where
+    // 'inside' equals 'target'.
+    vector<float> squared_distances(const vector<bool>& inside, bool target, int w, int h)
+    {
+        const int n = std::max(w, h);
+        vector<float> grid(w * h);
+        vector<float> f(n);
+        vector<float> d(n);
+        vector<int> v(n);
+        vector<float> z(n + 1);
+
+        for (int i = 0; i < w * h; ++i) {
+            grid[i] = (inside[i] == target) ? 0.0f : far_away;
+        }
+
+        for (int x = 0; x < w; ++x) {
+            for (int y = 0; y < h; ++y) f[y] = grid[y * w + x];
+            distance_transform_1d(f.data(), d.data(), h, v.data(), z.data());
+            for (int y = 0; y < h; ++y) grid[y * w + x] = d[y];
+        }
+
+        for (int y = 0; y < h; ++y) {
+            distance_transform_1d(&grid[y * w], d.data(), w, v.data(), z.data());
+            std::copy(d.begin(), d.begin() + w, grid.begin() + y * w);
+        }
+
+        return grid;
+    }
+}
+
+font_manager::font_manager(bool headless)
+{
+    m_text_font = GetFontDefault();
+    m_text_shader = {};
+    m_text_material = {};
+    m_outline_color_loc = -1;
+    m_outline_width_loc = -1;
+    m_smoothing_loc = -1;
+    m_headless = headless;
+
+    if (m_headless) return;
+
+    build_atlas(GetFontDefault());
+
+    m_text_shader = LoadShader(0, "res/shaders/sdf_text.frag");
+    m_outline_color_loc = GetShaderLocation(m_text_shader, "outlineColor");
+    m_outline_width_loc = GetShaderLocation(m_text_shader, "outlineWidth");
+    m_smoothing_loc = GetShaderLocation(m_text_shader, "smoothing");
+
+    m_text_material = LoadMaterialDefault();
+    m_text_material.shader = m_text_shader;
+    m_text_material.maps[MATERIAL_MAP_DIFFUSE].texture = m_text_font.texture;
+}
+
+font_manager::~font_manager()
+{
+    if (m_headless) return;
+
+    // The glyph tables belong to this manager, so only the atlas is unloaded. The material
+    // shares the atlas and shader, so only its maps are freed.
+    UnloadTexture(m_text_font.texture);
+    UnloadShader(m_text_shader);
+    MemFree(m_text_material.maps);
+}
+
+void font_manager::build_atlas(Font font)
+{
+    // Each glyph gets a cell of its own, with room for the field around it, packed in rows.
+    float glyph_h_max = 0.0f;
+    for (int i = 0; i < font.glyphCount; ++i) {
+        glyph_h_max = std::max(glyph_h_max, font.recs[i].height);
+    }
+    const int cell_h = glyph_h_max * m_upscale + 2 * m_spread;
+    vector<Vector2> cells(font.glyphCount);
+    int x = 0;
+    int y = 0;
+    for (int i = 0; i < font.glyphCount; ++i) {
+        const int cell_w = font.recs[i].width * m_upscale + 2 * m_spread;
+        if (x + cell_w > m_atlas_width) {
+            x = 0;
+            y += cell_h;
+        }
+        cells[i] = { static_cast<float>(x), static_cast<float>(y) };
+        x += cell_w;
+    }
+    const int atlas_h = y + cell_h;
+
+    vector<unsigned char> pixels(m_atlas_width * atlas_h, 0);
+    m_recs.resize(font.glyphCount);
+    m_glyphs.resize(font.glyphCount);
+
+    for (int i = 0; i < font.glyphCount; ++i) {
+        const GlyphInfo& info = font.glyphs[i];
+        const int glyph_w = font.recs[i].width;
+        const int glyph_h = font.recs[i].height;
+        const int cell_w = glyph_w * m_upscale + 2 * m_spread;
+        const int cell_x = cells[i].x;
+        const int cell_y = cells[i].y;
+
+        // Scale the glyph up without smoothing, so its pixels stay square.
+        vector<bool> inside(cell_w * cell_h, false);
+        for (int py = 0; py < glyph_h * m_upscale; ++py) {
+            for (int px = 0; px < glyph_w * m_upscale; ++px) {
+                const Color c = GetImageColor(info.image, px / m_upscale, py / m_upscale);
+                inside[(py + m_spread) * cell_w + px + m_spread] = (c.a > 0);
+            }
+        }
+
+        const vector<float> to_inside = squared_distances(inside, true, cell_w, cell_h);
+        const vector<float> to_outside = squared_distances(inside, false, cell_w, cell_h);
+
+        // The edge lies half a pixel from the centers of the pixels either side of it. Inside
+        // is above 0.5, and the field reaches 0 and 1 at 'm_spread' pixels from the edge.
+        for (int i_px = 0; i_px < cell_w * cell_h; ++i_px) {
+            const float dist = inside[i_px]
+                ? -(std::sqrt(to_outside[i_px]) - 0.5f)
+                : std::sqrt(to_inside[i_px]) - 0.5f;
+            const float value = std::clamp(0.5f - dist / (2.0f * m_spread), 0.0f, 1.0f);
+            pixels[(cell_y + i_px / cell_w) * m_atlas_width + cell_x + i_px % cell_w] =
+                static_cast<unsigned char>(std::lround(value * 255.0f));
+        }
+
+        m_recs[i] = {
+            static_cast<float>(cell_x + m_spread),
+            static_cast<float>(cell_y + m_spread),
+            static_cast<float>(glyph_w * m_upscale),
+            static_cast<float>(glyph_h * m_upscale)
+        };
+        m_glyphs[i] = info;
+        m_glyphs[i].offsetX *= m_upscale;
+        m_glyphs[i].offsetY *= m_upscale;
+        m_glyphs[i].advanceX *= m_upscale;
+        m_glyphs[i].image = {};
+    }
+
+    Image atlas = {
+        pixels.data(),
+        m_atlas_width,
+        atlas_h,
+        1,
+        PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
+    };
+
+    m_text_font = font;
+    m_text_font.baseSize = font.baseSize * m_upscale;
+    m_text_font.glyphPadding = m_spread;
+    m_text_font.texture = LoadTextureFromImage(atlas);
+    m_text_font.recs = m_recs.data();
+    m_text_font.glyphs = m_glyphs.data();
+    SetTextureFilter(m_text_font.texture, TEXTURE_FILTER_BILINEAR);
+}
+
+size_t font_manager::draw_text(glyph_mesh& mesh, Matrix transform, Color color, Color outline_color,
+                               float outline_size, float font_size)
+{
+    if (m_headless) return 0;
+
+    const Rectangle canvas = { 0.0f, 0.0f, static_cast<float>(game::get_w()), static_cast<float>(game::get_h()) };
+    const size_t visible = mesh.cull(transform, canvas);
+    if (visible == 0) {
+        return 0;
+    }
+
+    // One screen pixel in field units, at this font size.
+    const float pixel = m_text_font.baseSize / (std::max(font_size, 1.0f) * 2.0f * m_spread);
+    const float smoothing = 0.5f * pixel;
+
+    float outline_width = 0.0f;
+    if (outline_color.a != 0 && outline_size > 0.0f) {
+        outline_width = std::min(outline_size * pixel, 0.5f - smoothing);
+    }
+
+    const Vector4 outline = ColorNormalize(outline_color);
+    SetShaderValue(m_text_shader, m_outline_color_loc, &outline, SHADER_UNIFORM_VEC4);
+    SetShaderValue(m_text_shader, m_outline_width_loc, &outline_width, SHADER_UNIFORM_FLOAT);
+    SetShaderValue(m_text_shader, m_smoothing_loc, &smoothing, SHADER_UNIFORM_FLOAT);
+
+    m_text_material.maps[MATERIAL_MAP_DIFFUSE].color = color;
+    mesh.draw(m_text_material, transform);
+    return visible;
+}
@@ -0,0 +1,217 @@
+/***********************************************************************************************
+*
+*   frame_profiler.cpp - Per-phase frame timing and its in-game overlay.
+*
+*   Copyright (c) 2025 Josh Hayden (@BlinkDynamo)
+*
+*   Blink's Thinks is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License v3.0 as published
+*   by the Free Software Foundation.
+*
+*   Blink's Thinks is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*
+***********************************************************************************************/
+
+// Source.
+#include "game.hpp"
+#include "frame_profiler.hpp"
+
+// Standard library.
+#include <algorithm>
+
+using engine::frame_profiler;
+
+frame_profiler::frame_profiler()
+    :
+    m_current{},
+    m_frame_start(clock::now()),
+    m_frame_ms(0.0f),
+    m_current_allocs{},
+    m_frame_start_allocs{},
+    m_frame_allocs{},
+    m_glyphs_emitted(0),
+    m_glyphs_culled(0),
+    m_stack{},
+    m_depth(0),
+    m_history{},
+    m_frame_history{},
+    m_alloc_history{},
+    m_frame_alloc_history{},
+    m_history_head(0),
+    m_history_count(0),
+    m_visible(false)
+{}
+
+void frame_profiler::begin_frame()
+{
+    m_current.fill(0.0f);
+    m_current_allocs.fill({0, 0});
+    m_frame_start = clock::now();
+    m_frame_start_allocs = alloc_tracker::get_counts();
+    m_glyphs_emitted = 0;
+    m_glyphs_culled = 0;
+}
+
+void frame_profiler::end_frame()
+{
+    GAME_ASSERT(m_depth == 0, "A profiler phase was still open at the end of the frame.");
+
+    m_frame_ms = to_ms(clock::now() - m_frame_start);
+    m_frame_allocs = {0, 0};
+    add_allocs(m_frame_allocs, m_frame_start_allocs, alloc_tracker::get_counts());
+
+    m_history[m_history_head] = m_current;
+    m_frame_history[m_history_head] = m_frame_ms;
+    for (size_t p = 0; p < phase_count; ++p) {
+        m_alloc_history[m_history_head][p] = static_cast<uint32_t>(m_current_allocs[p].allocations);
+    }
+    m_frame_alloc_history[m_history_head] = static_cast<uint32_t>(m_frame_allocs.allocations);
+    m_history_head = (m_history_head + 1) % m_history_size;
+    m_history_count = std::min(m_history_count + 1, m_history_size);
+}
+
+void frame_profiler::begin_phase(phase p)
+{
+    GAME_ASSERT(m_depth < m_max_depth, "Profiler phases are nested too deeply.");
+
+    const clock::time_point now = clock::now();
+    const alloc_tracker::counts allocs = alloc_tracker::get_counts();
+
+    // Pause the enclosing phase while this one runs.
+    if (m_depth > 0) {
+        open_phase& outer = m_stack[m_depth - 1];
+        m_current[static_cast<size_t>(outer.p)] += to_ms(now - outer.start);
+        add_allocs(m_current_allocs[static_cast<size_t>(outer.p)], outer.start_allocs, allocs);
+    }
+
+    m_stack[m_depth++] = {p, now, allocs};
+}
+
+void frame_profiler::end_phase(phase p)
+{
+    GAME_ASSERT(m_depth > 0 && m_stack[m_depth - 1].p == p, "Profiler phases ended out of order.");
+
+    const clock::time_point now = clock::now();
+    const alloc_tracker::counts allocs = alloc_tracker::get_counts();
+    const open_phase& inner = m_stack[--m_depth];
+    m_current[static_cast<size_t>(p)] += to_ms(now - inner.start);
+    add_allocs(m_current_allocs[static_cast<size_t>(p)], inner.start_allocs, allocs);
+
+    // Resume the enclosing phase.
+    if (m_depth > 0) {
+        m_stack[m_depth - 1].start = now;
+        m_stack[m_depth - 1].start_allocs = allocs;
+    }
+}
+
+void frame_profiler::draw(size_t entity_count, size_t awake_count, size_t button_count)
+{
+    constexpr int x = 10;
+    constexpr int y = 10;
+    constexpr int padding = 8;
+    constexpr int font_size = 10;
+    constexpr int line_height = 14;
+    constexpr int graph_height = 80;
+    constexpr int allocs_x = 212;
+    constexpr int width = std::max(static_cast<int>(m_history_size), allocs_x + 40) + 2 * padding;
+    constexpr int height = graph_height + (static_cast<int>(phase_count) + 4) * line_height + 3 * padding;
+
+    DrawRectangle(x, y, width, height, {0, 0, 0, 190});
+
+    //
+    // Rolling graph of the last frames, oldest on the left, with each phase stacked.
+    //
+    const int graph_x = x + padding;
+    const int graph_bottom = y + padding + graph_height;
+    const float px_per_ms = graph_height / m_graph_scale_ms;
+
+    for (size_t i = 0; i < m_history_count; ++i) {
+        const size_t slot = (m_history_head + m_history_size - m_history_count + i) % m_history_size;
+        const int column = graph_x + static_cast<int>(m_history_size - m_history_count + i);
+        float stacked_ms = 0.0f;
+
+        for (size_t p = 0; p < phase_count; ++p) {
+            const int top = graph_bottom - static_cast<int>((stacked_ms + m_history[slot][p]) * px_per_ms);
+            const int bottom = graph_bottom - static_cast<int>(stacked_ms * px_per_ms);
+            if (bottom > top) {
+                DrawRectangle(column, std::max(top, graph_bottom - graph_height), 1, bottom - top, m_phase_colors[p]);
+            }
+            stacked_ms += m_history[slot][p];
+        }
+
+        // The rest of the frame (mostly waiting on vsync) in gray.
+        const float frame_ms = std::min(m_frame_history[slot], m_graph_scale_ms);
+        if (frame_ms > stacked_ms) {
+            const int top = graph_bottom - static_cast<int>(frame_ms * px_per_ms);
+            const int bottom = graph_bottom - static_cast<int>(stacked_ms * px_per_ms);
+            DrawRectangle(column, top, 1, bottom - top, {80, 80, 80, 255});
+        }
+    }
+
+    const int budget_y = graph_bottom - static_cast<int>(m_budget_ms * px_per_ms);
+    DrawLine(graph_x, budget_y, graph_x + static_cast<int>(m_history_size), budget_y, WHITE);
+
+    //
+    // Average and worst time of each phase over the history, and its most allocations in a
+    // frame when they are tracked.
+    //
+    int line_y = graph_bottom + padding;
+    DrawText("phase              avg ms   max ms", graph_x, line_y, font_size, LIGHTGRAY);
+    if constexpr (alloc_tracker::enabled) {
+        DrawText("allocs", graph_x + allocs_x, line_y, font_size, LIGHTGRAY);
+    }
+    line_y += line_height;
+
+    const float frames = std::max<float>(m_history_count, 1.0f);
+
+    for (size_t p = 0; p < phase_count; ++p) {
+        float total_ms = 0.0f;
+        float max_ms = 0.0f;
+        for (size_t i = 0; i < m_history_count; ++i) {
+            total_ms += m_history[i][p];
+            max_ms = std::max(max_ms, m_history[i][p]);
+        }
+
+        DrawRectangle(graph_x, line_y + 1, 8, 8, m_phase_colors[p]);
+        DrawText(m_phase_names[p], graph_x + 12, line_y, font_size, WHITE);
+        DrawText(TextFormat("%6.2f   %6.2f", total_ms / frames, max_ms), graph_x + 124, line_y, font_size, WHITE);
+
+        if constexpr (alloc_tracker::enabled) {
+            uint32_t max_allocs = 0;
+            for (size_t i = 0; i < m_history_count; ++i) {
+                max_allocs = std::max(max_allocs, m_alloc_history[i][p]);
+            }
+            DrawText(TextFormat("%6u", max_allocs), graph_x + allocs_x, line_y, font_size, max_allocs > 0 ? RED : WHITE);
+        }
+        line_y += line_height;
+    }
+
+    float total_frame_ms = 0.0f;
+    float max_frame_ms = 0.0f;
+    for (size_t i = 0; i < m_history_count; ++i) {
+        total_frame_ms += m_frame_history[i];
+        max_frame_ms = std::max(max_frame_ms, m_frame_history[i]);
+    }
+
+    DrawText("frame", graph_x + 12, line_y, font_size, LIGHTGRAY);
+    DrawText(TextFormat("%6.2f   %6.2f", total_frame_ms / frames, max_frame_ms), graph_x + 124, line_y, font_size, LIGHTGRAY);
+
+    if constexpr (alloc_tracker::enabled) {
+        const uint32_t max_frame_allocs = *std::max_element(m_frame_alloc_history.begin(), m_frame_alloc_history.end());
+        DrawText(TextFormat("%6u", max_frame_allocs), graph_x + allocs_x, line_y, font_size, max_frame_allocs > 0 ? RED : LIGHTGRAY);
+    }
+    line_y += line_height;
+
+    DrawText(TextFormat("entities: %zu (%zu awake)   buttons: %zu", entity_count, awake_count, button_count),
+             graph_x, line_y, font_size, WHITE);
+    line_y += line_height;
+
+    DrawText(TextFormat("glyphs: %zu drawn   %zu culled", m_glyphs_emitted, m_glyphs_culled),
+             graph_x, line_y, font_size, WHITE);
+}
@@ -0,0 +1,170 @@
+/***********************************************************************************************
+*
+*   frame_report.cpp - Per-level frame-time histograms and their percentile report.
+*
+*   Copyright (c) 2025 Josh Hayden (@BlinkDynamo)
+*
+*   Blink's Thinks is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License v3.0 as published
+*   by the Free Software Foundation.
+*
+*   Blink's Thinks is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*
+***********************************************************************************************/
+
+// Source.
+#include "frame_report.hpp"
+
+// Raylib.
+#include "raylib.h"
+
+// Standard library.
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+using engine::frame_report;
+
+using phase = engine::frame_profiler::phase;
+
+void frame_report::histogram::add(float ms)
+{
+    const size_t bucket = std::min(static_cast<size_t>(std::max(ms, 0.0f) / m_bucket_ms), m_bucket_count - 1);
+    ++m_buckets[bucket];
+    ++m_count;
+    m_total_ms += ms;
+    m_max_ms = std::max(m_max_ms, ms);
+}
+
+float frame_report::histogram::get_percentile(float fraction) const
+{
+    if (m_count == 0) {
+        return 0.0f;
+    }
+
+    const uint64_t rank = static_cast<uint64_t>(std::ceil(fraction * m_count));
+    uint64_t seen = 0;
+
+    // The last bucket has no upper edge, so a percentile there is only bounded by the worst case.
+    for (size_t i = 0; i < m_bucket_count - 1; ++i) {
+        seen += m_buckets[i];
+        if (seen >= rank) {
+            // Never report more than the slowest frame actually seen.
+            return std::min((i + 1) * m_bucket_ms, m_max_ms);
+        }
+    }
+    return m_max_ms;
+}
+
+frame_report::frame_report()
+    :
+    m_current(nullptr),
+    m_path_prefix("frame_report")
+{}
+
+void frame_report::begin_level(const string& level_name)
+{
+    m_current = &m_levels[level_name];
+}
+
+void frame_report::record(const std::array<float, frame_profiler::phase_count>& phase_ms, float frame_ms)
+{
+    if (m_current == nullptr) {
+        return;
+    }
+
+    const auto ms = [&phase_ms](phase p) { return phase_ms[static_cast<size_t>(p)]; };
+
+    m_current->frame.add(frame_ms);
+    m_current->update.add(ms(phase::LEVEL_SWAP) + ms(phase::LEVEL_UPDATE) + ms(phase::AUDIO_UPDATE));
+    m_current->draw.add(ms(phase::BACKGROUND_DRAW) + ms(phase::SHADER_PROCESS) + ms(phase::ENTITY_DRAW) + ms(phase::PRESENT));
+}
+
+void frame_report::write()
+{
+    const string json_path = m_path_prefix + ".json";
+    std::FILE* json = std::fopen(json_path.c_str(), "w");
+    if (json == nullptr) {
+        TraceLog(LOG_ERROR, "[%s] Could not open '%s' for writing.", __PRETTY_FUNCTION__, json_path.c_str());
+        return;
+    }
+
+    const auto write_histogram = [json](const char* name, const histogram& h, const char* separator) {
+        std::fprintf(
+            json,
+            "    \"%s\": {\"mean_ms\": %.3f, \"p50_ms\": %.3f, \"p95_ms\": %.3f, \"p99_ms\": %.3f, \"max_ms\": %.3f}%s\n",
+            name,
+            h.get_mean(),
+            h.get_percentile(0.50f),
+            h.get_percentile(0.95f),
+            h.get_percentile(0.99f),
+            h.get_max(),
+            separator
+        );
+    };
+
+    std::fputs("{\n", json);
+    size_t i = 0;
+    for (const auto& [name, stats] : m_levels) {
+        // Level names are C++ class names, which never need escaping in JSON.
+        std::fprintf(json, "  \"%s\": {\n    \"frames\": %llu,\n", name.c_str(),
+                     static_cast<unsigned long long>(stats.frame.get_count()));
+        write_histogram("frame", stats.frame, ",");
+        write_histogram("update", stats.update, ",");
+        write_histogram("draw", stats.draw, "");
+        std::fprintf(json, "  }%s\n", ++i == m_levels.size() ? "" : ",");
+    }
+    std::fputs("}\n", json);
+    std::fclose(json);
+
+    const string table_path = m_path_prefix + ".txt";
+    std::FILE* table = std::fopen(table_path.c_str(), "w");
+    if (table == nullptr) {
+        TraceLog(LOG_ERROR, "[%s] Could not open '%s' for writing.", __PRETTY_FUNCTION__, table_path.c_str());
+        return;
+    }
+    std::fputs(format_table().c_str(), table);
+    std::fclose(table);
+}
+
+void frame_report::finish()
+{
+    write();
+    TraceLog(LOG_INFO, "[%s] Frame times by level (ms):\n%s", __PRETTY_FUNCTION__, format_table().c_str());
+}
+
+string frame_report::format_table()
+{
+    string table;
+    char line[256];
+
+    std::snprintf(line, sizeof(line), "%-20s %8s %8s %8s %8s %8s %10s %10s\n",
+                  "level", "frames", "p50", "p95", "p99", "max", "update", "draw");
+    table += line;
+
+    for (const auto& [name, stats] : m_levels) {
+        std::snprintf(
+            line,
+            sizeof(line),
+            "%-20s %8llu %8.2f %8.2f %8.2f %8.2f %10.2f %10.2f\n",
+            name.c_str(),
+            static_cast<unsigned long long>(stats.frame.get_count()),
+            stats.frame.get_percentile(0.50f),
+            stats.frame.get_percentile(0.95f),
+            stats.frame.get_percentile(0.99f),
+            stats.frame.get_max(),
+            stats.update.get_mean(),
+            stats.draw.get_mean()
+        );
+        table += line;
+    }
+
+    table += "(update and draw are mean ms per frame)\n";
+    return table;
+}
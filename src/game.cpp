@@ -20,11 +20,19 @@
 
 // Source.
 #include "game.hpp"
+#include "zone.hpp"
 
 // Standard library.
-#include <unordered_set>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <typeinfo>
 //#include <algorithm>
 
+#if defined(__GNUC__) || defined(__clang__)
+#include <cxxabi.h>
+#endif
+
 #ifdef PLATFORM_WEB
 #include <emscripten.h>
 namespace web
@@ -36,51 +44,148 @@ namespace web
 using engine::game;
 using engine::audio_manager;
 using engine::shader_manager;
+using engine::random_manager;
+
+namespace
+{
+    // The unqualified class name of a level, for the profiling reports.
+    string get_level_name(const engine::level& lvl)
+    {
+        const char* name = typeid(lvl).name();
+
+#if defined(__GNUC__) || defined(__clang__)
+        int status = 0;
+        char* demangled = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+        if (status == 0 && demangled != nullptr) {
+            const string qualified = demangled;
+            std::free(demangled);
+
+            const size_t scope = qualified.rfind("::");
+            return scope == string::npos ? qualified : qualified.substr(scope + 2);
+        }
+#endif
+
+        return name;
+    }
+}
 
 game::game()
+    :
+    m_level_memory(std::pmr::pool_options{m_level_memory_blocks_per_chunk, m_level_memory_largest_block})
 {
     std::random_device random_generator_seed;
-    m_random_generator.seed(random_generator_seed());
+    random = new random_manager(random_generator_seed());
+    profiler = new frame_profiler();
+    flight = new flight_recorder();
+    report = new frame_report();
+    handles = new entity_handles();
+
+    this->m_button_in_hand = {};
+
+    this->m_tick_rate = m_default_tick_rate;
+    this->m_max_ticks_per_frame = m_default_max_ticks_per_frame;
+    this->m_tick_count = 0;
+    this->m_tick_limit = 0;
+    this->m_sim_time = 0.0;
+
+    this->m_input = {};
+    this->m_input.in_canvas = true;
+    this->m_tick_input = m_input;
+    this->m_replay_finished = false;
+
+    this->m_current_level = nullptr;
+    this->m_next_level = nullptr;
+    this->m_frames_since_level_change = 0;
+    this->m_assert_no_alloc = false;
+    this->m_report_pending = false;
 
-    this->m_button_in_hand = nullptr;
+    alloc_tracker::track_this_thread();
+
+    this->m_synthetic_input_generator.seed(0);
+    this->m_synthetic_mouse_target = {m_cw, m_ch};
 
-    InitWindow(m_w, m_h, m_game_name);
-    SetWindowSize(m_w, m_h);
-    SetTargetFPS(m_frame_rate);
-    SetExitKey(KEY_NULL);
     SetTraceLogLevel(LOG_DEBUG);
 
+    if (!m_headless) {
+        // Drawing is no longer tied to the simulation rate, so draw as often as the display
+        // refreshes.
+        SetConfigFlags(FLAG_VSYNC_HINT);
+        InitWindow(m_w, m_h, m_game_name);
+        SetWindowSize(m_w, m_h);
+        SetTargetFPS(GetMonitorRefreshRate(GetCurrentMonitor()));
+        SetExitKey(KEY_NULL);
+    }
+
     // Initialize managers after window creation.
-    audio = new audio_manager();
-    shaders = new shader_manager();
+    audio = new audio_manager(m_headless);
+    shaders = new shader_manager(m_headless);
+    fonts = new font_manager(m_headless);
 }
 
 game::~game()
 {
+    delete handles;
+    delete report;
+    delete flight;
+    delete profiler;
+    delete random;
+    delete fonts;
     delete shaders;
     delete audio;
-    CloseWindow();
+    if (!m_headless) {
+        CloseWindow();
+    }
 }
 
 void game::run()
 {
-    while (!WindowShouldClose())
+    if (m_headless) {
+        run_headless();
+    }
+    else {
+        run_windowed();
+    }
+
+    flight->flush();
+    report->finish();
+
+    if constexpr (zones_enabled) {
+        zone_recorder::get_instance().write(zone_recorder::get_instance().get_path());
+    }
+}
+
+void game::run_windowed()
+{
+    double previous_time = GetTime();
+    double accumulator = 0.0;
+
+    while (!WindowShouldClose() && !is_finished())
     {
+        const double tick_duration = 1.0 / m_tick_rate;
+        const double current_time = GetTime();
+        accumulator += current_time - previous_time;
+        previous_time = current_time;
+
+        GAME_ZONE("frame");
+        profiler->begin_frame();
+
+        latch_input();
+
         // ---------------------------------------------------------------------------------- //
         //                                      Update.                                       //
         // ---------------------------------------------------------------------------------- //
-        if (m_next_level != nullptr) {
-            if (m_current_level != nullptr) {
-                delete m_current_level;
-            }
-            m_current_level = m_next_level;
-            m_next_level = nullptr;
-        }
-        if (m_current_level != nullptr) {
-            m_current_level->update();
+        size_t ticks_this_frame = 0;
+        while (accumulator >= tick_duration && ticks_this_frame < m_max_ticks_per_frame &&
+               !is_finished()) {
+            tick();
+            accumulator -= tick_duration;
+            ++ticks_this_frame;
         }
 
-        audio->update();
+        // Too far behind to catch up. Drop the whole ticks that are left over.
+        if (accumulator >= tick_duration) {
+            accumulator = std::fmod(accumulator, tick_duration);
+        }
 
         // ---------------------------------------------------------------------------------- //
         //                                       Draw.                                        //
@@ -88,63 +193,298 @@ void game::run()
         BeginDrawing();
         ClearBackground(RAYWHITE);
 
+        // How far between the last tick and the next the display currently is.
+        const float alpha = static_cast<float>(accumulator / tick_duration);
+
         if (m_current_level != nullptr) {
-            m_current_level->draw();
+            profiler->begin_phase(frame_profiler::phase::ENTITY_DRAW);
+            m_current_level->draw(alpha);
+            profiler->end_phase(frame_profiler::phase::ENTITY_DRAW);
+
+            if (profiler->is_visible()) {
+                profiler->draw(
+                    m_current_level->get_entity_count(),
+                    m_current_level->get_awake_entity_count(),
+                    m_current_level->get_button_count()
+                );
+            }
+        }
+
+        profiler->begin_phase(frame_profiler::phase::PRESENT);
+        {
+            GAME_ZONE("EndDrawing");
+            EndDrawing();
         }
+        profiler->end_phase(frame_profiler::phase::PRESENT);
 
-        EndDrawing();
+        end_frame();
     }
 }
 
-int game::get_random_value(int min, int max)
+void game::run_headless()
 {
-    GAME_ASSERT(max - min > 0, "Invalid range supplied.");
-    std::uniform_int_distribution<int> distribution(min, max);
-    return distribution(m_random_generator);
+    const auto start_time = std::chrono::steady_clock::now();
+
+    while (!is_finished()) {
+        profiler->begin_frame();
+        if (!m_input_log.is_replaying()) {
+            synthesize_input();
+        }
+        tick();
+        end_frame();
+    }
+
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_time;
+    TraceLog(
+        LOG_INFO,
+        "[%s] Ran %zu ticks in %.3f s (%.0f ticks/s).",
+        __PRETTY_FUNCTION__,
+        m_tick_count,
+        elapsed.count(),
+        m_tick_count / elapsed.count()
+    );
 }
 
-vector<int> game::get_random_sequence(size_t count, int min, int max, vector<int> exclude)
+void game::tick()
 {
-    GAME_ASSERT(
-        [&]{
-            const size_t range_size = max - min + 1;
-            return count <= range_size;
-        }(),
-        "Requested more unique numbers than available range."
-    ); 
+    GAME_ZONE_FUNCTION();
+
+    // Take the snapshot of this tick. The edges latched since the last tick go to this one.
+    if (m_input_log.is_replaying()) {
+        if (!m_input_log.read(m_tick_input)) {
+            TraceLog(LOG_INFO, "[%s] Replay finished after %zu ticks.", __PRETTY_FUNCTION__, m_tick_count);
+            m_replay_finished = true;
+            return;
+        }
+    }
+    else {
+        m_tick_input = m_input;
+        m_input.mouse_buttons_pressed = 0;
+        m_input.key_count = 0;
+    }
+    m_tick_input.tick = m_tick_count;
+    m_tick_input.sim_time = m_sim_time;
 
-    std::unordered_set<int> exclusion_set(exclude.begin(), exclude.end());
+    if (m_input_log.is_recording()) {
+        m_input_log.write(m_tick_input);
+    }
 
-    vector<int> pool;
-    for (int num = min; num <= max; ++num) {
-        if (exclusion_set.find(num) == exclusion_set.end()) {
-            pool.push_back(num);
+    if (m_next_level != nullptr) {
+        profiler->begin_phase(frame_profiler::phase::LEVEL_SWAP);
+        if (m_current_level != nullptr) {
+            delete m_current_level;
+            m_report_pending = true;
         }
-    } 
+        m_current_level = m_next_level;
+        m_current_level_name = get_level_name(*m_current_level);
+        m_frames_since_level_change = 0;
+        report->begin_level(m_current_level_name);
+        m_next_level = nullptr;
+        profiler->end_phase(frame_profiler::phase::LEVEL_SWAP);
+    }
+    if (m_current_level != nullptr) {
+        profiler->begin_phase(frame_profiler::phase::LEVEL_UPDATE);
+        m_current_level->update();
+        profiler->end_phase(frame_profiler::phase::LEVEL_UPDATE);
+    }
 
-    std::shuffle(pool.begin(), pool.end(), m_random_generator);
-    return {pool.begin(), pool.begin() + static_cast<long>(count)};
+    profiler->begin_phase(frame_profiler::phase::AUDIO_UPDATE);
+    audio->update();
+    profiler->end_phase(frame_profiler::phase::AUDIO_UPDATE);
+
+    ++m_tick_count;
+    m_sim_time += 1.0 / m_tick_rate;
 }
 
-Color game::get_random_color()
+void game::end_frame()
 {
-    return m_bright_colors.at(get_random_value(0, m_bright_colors.size() - 1));
+    profiler->end_frame();
+    flight->record(m_current_level_name, m_tick_count, profiler->get_phase_times(), profiler->get_frame_time());
+    report->record(profiler->get_phase_times(), profiler->get_frame_time());
+
+    if (m_report_pending) {
+        report->write();
+        m_report_pending = false;
+    }
+
+    if constexpr (alloc_tracker::enabled) {
+        check_frame_allocs();
+    }
+    ++m_frames_since_level_change;
 }
 
-vector<Color> game::get_random_color_sequence(size_t count)
+void game::check_frame_allocs()
 {
-    GAME_ASSERT(count <= m_bright_colors.size() ,"Requested more unique colors than available maximum."); 
+    const alloc_tracker::counts frame_allocs = profiler->get_frame_allocs();
+    if (!m_assert_no_alloc || frame_allocs.allocations == 0 ||
+        m_frames_since_level_change <= m_alloc_settle_frames) {
+        return;
+    }
+
+    TraceLog(
+        LOG_ERROR,
+        "[%s] Steady-state frame in %s at tick %zu made %llu allocations (%llu bytes).",
+        __PRETTY_FUNCTION__,
+        m_current_level_name.c_str(),
+        m_tick_count,
+        static_cast<unsigned long long>(frame_allocs.allocations),
+        static_cast<unsigned long long>(frame_allocs.bytes)
+    );
 
-    // Copy game defined constant vector, shuffle it, then return the count asked for.
-    vector<Color> palate = m_bright_colors;
-    std::shuffle(palate.begin(), palate.end(), m_random_generator);
-    return {palate.begin(), palate.begin() + static_cast<long>(count)};
+    for (size_t p = 0; p < frame_profiler::phase_count; ++p) {
+        const alloc_tracker::counts& phase_allocs = profiler->get_phase_allocs()[p];
+        if (phase_allocs.allocations > 0) {
+            TraceLog(
+                LOG_ERROR,
+                "[%s]     %s: %llu allocations (%llu bytes).",
+                __PRETTY_FUNCTION__,
+                frame_profiler::get_phase_name(static_cast<frame_profiler::phase>(p)),
+                static_cast<unsigned long long>(phase_allocs.allocations),
+                static_cast<unsigned long long>(phase_allocs.bytes)
+            );
+        }
+    }
+
+    std::abort();
 }
 
-bool game::mouse_in_canvas() {
+bool game::is_finished()
+{
+    return m_replay_finished || (m_tick_limit != 0 && m_tick_count >= m_tick_limit);
+}
+
+bool game::start_recording(const string& path)
+{
+    return m_input_log.start_recording(path, get_seed(), m_tick_rate);
+}
+
+bool game::start_replay(const string& path)
+{
+    if (!m_input_log.start_replay(path)) {
+        return false;
+    }
+
+    set_seed(m_input_log.get_seed());
+    set_tick_rate(m_input_log.get_tick_rate());
+    return true;
+}
+
+void game::latch_input()
+{
+    m_input.mouse_position = GetMousePosition();
+    m_input.mouse_buttons_down = 0;
+
+    for (int button = MOUSE_BUTTON_LEFT; button <= MOUSE_BUTTON_MIDDLE; ++button) {
+        if (IsMouseButtonPressed(button)) {
+            m_input.mouse_buttons_pressed |= (1u << button);
+        }
+        if (IsMouseButtonDown(button)) {
+            m_input.mouse_buttons_down |= (1u << button);
+        }
+    }
+
     #ifdef PLATFORM_WEB
-    return web::mouse_in_canvas();
+    m_input.in_canvas = web::mouse_in_canvas();
     #else
-    return IsWindowFocused();
+    m_input.in_canvas = IsWindowFocused();
     #endif
+
+    for (int key = GetKeyPressed(); key != 0; key = GetKeyPressed()) {
+        if (key == m_profiler_key) {
+            profiler->toggle_visible();
+        }
+        else if (key == m_trace_key && zones_enabled) {
+            zone_recorder::get_instance().write(zone_recorder::get_instance().get_path());
+        }
+        else if (m_input.key_count < m_input.keys_pressed.size()) {
+            m_input.keys_pressed[m_input.key_count++] = key;
+        }
+    }
+}
+
+void game::synthesize_input()
+{
+    std::uniform_real_distribution<float> x_distribution(0.0f, m_w);
+    std::uniform_real_distribution<float> y_distribution(0.0f, m_h);
+    std::uniform_int_distribution<int> chance(0, 99);
+
+    // Glide towards the current target, picking a new one on arrival.
+    constexpr float mouse_speed = 12.0f;
+    const float dx = m_synthetic_mouse_target.x - m_input.mouse_position.x;
+    const float dy = m_synthetic_mouse_target.y - m_input.mouse_position.y;
+    const float distance = std::sqrt(dx * dx + dy * dy);
+
+    if (distance <= mouse_speed) {
+        m_input.mouse_position = m_synthetic_mouse_target;
+        m_synthetic_mouse_target = {
+            x_distribution(m_synthetic_input_generator),
+            y_distribution(m_synthetic_input_generator)
+        };
+    }
+    else {
+        m_input.mouse_position.x += dx / distance * mouse_speed;
+        m_input.mouse_position.y += dy / distance * mouse_speed;
+    }
+
+    // Toggle the left button now and then, latching a press when it goes down.
+    if (chance(m_synthetic_input_generator) < 4) {
+        const unsigned int left = 1u << MOUSE_BUTTON_LEFT;
+        if (m_input.mouse_buttons_down & left) {
+            m_input.mouse_buttons_down &= ~left;
+        }
+        else {
+            m_input.mouse_buttons_down |= left;
+            m_input.mouse_buttons_pressed |= left;
+        }
+    }
+
+    // Occasionally skip ahead like a player would with enter on the intros.
+    if (chance(m_synthetic_input_generator) == 0 && m_input.key_count < m_input.keys_pressed.size()) {
+        m_input.keys_pressed[m_input.key_count++] = KEY_ENTER;
+    }
+}
+
+bool game::is_mouse_button_pressed(int button)
+{
+    return (m_tick_input.mouse_buttons_pressed & (1u << button)) != 0;
+}
+
+bool game::is_key_pressed(int key)
+{
+    for (size_t i = 0; i < m_tick_input.key_count; ++i) {
+        if (m_tick_input.keys_pressed[i] == key) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int game::get_random_value(int min, int max)
+{
+    return random->get_value(random_manager::stream::LAYOUT, min, max);
+}
+
+void game::get_random_sequence(std::span<int> out, int min, int max,
+                               std::initializer_list<int> exclude)
+{
+    random->get_sequence(random_manager::stream::LAYOUT, out, min, max, exclude);
+}
+
+Color game::get_random_color()
+{
+    return m_bright_colors[random->get_value(random_manager::stream::COLORS, 0, m_bright_colors.size() - 1)];
+}
+
+void game::get_random_color_sequence(std::span<Color> out)
+{
+    GAME_ASSERT(out.size() <= m_bright_colors.size(), "Requested more unique colors than available maximum.");
+
+    // Shuffle a copy of the palette on the stack, then take the count asked for.
+    std::array<Color, m_bright_colors.size()> palette = m_bright_colors;
+    random->partial_shuffle(random_manager::stream::COLORS, std::span<Color>(palette), out.size());
+    std::copy(palette.begin(), palette.begin() + out.size(), out.begin());
+}
+
+bool game::mouse_in_canvas() {
+    return m_tick_input.in_canvas;
 }
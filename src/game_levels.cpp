@@ -34,13 +34,26 @@ using engine::grabbable;
 #include <limits.h>
 
 using std::to_string;
+using std::array;
+using std::span;
+
+namespace
+{
+    // Order the buttons dropped in a submission box from left to right, as they read.
+    void sort_by_position_x(vector<button*>& buttons)
+    {
+        std::stable_sort(buttons.begin(), buttons.end(), [](button* a, button* b) {
+            return a->get_position().x < b->get_position().x;
+        });
+    }
+}
 
 // ------------------------------------------------------------------------------------------ //
 //                                     Raylib animation.                                      //
 // ------------------------------------------------------------------------------------------ //
 intro_raylib::intro_raylib()
 {
-    this->m_animation = add_entity(new anim_raylib());
+    this->m_animation = add_entity(new (m_arena) anim_raylib());
     m_game.audio->set_next_music("title_theme"); 
 }
 
@@ -51,7 +64,7 @@ void intro_raylib::update()
     if (m_animation->is_finished()) {
         m_game.set_next_level(new intro_self_credit());
     }
-    else if (IsKeyPressed(KEY_ENTER)) {
+    else if (m_game.is_key_pressed(KEY_ENTER)) {
         m_game.set_next_level(new level_title());
     }
 }
@@ -61,14 +74,14 @@ void intro_raylib::update()
 // ------------------------------------------------------------------------------------------ //
 intro_self_credit::intro_self_credit()
 {
-    this->m_animation = add_entity(new anim_self_credit());
+    this->m_animation = add_entity(new (m_arena) anim_self_credit());
 }
 
 void intro_self_credit::update()
 {
     level::update();
 
-    if (m_animation->is_finished() || IsKeyPressed(KEY_ENTER)) {
+    if (m_animation->is_finished() || m_game.is_key_pressed(KEY_ENTER)) {
         m_game.set_next_level(new level_title());
     }
 }
@@ -100,7 +113,7 @@ level_title::level_title()
 
     // Display the current version number in the bottom right.
     add_entity(
-        new text(
+        new (m_arena) text(
             version_and_build_display_str,
             20,
             RAYWHITE,
@@ -183,7 +196,7 @@ void level_win::update()
 // ------------------------------------------------------------------------------------------ //
 intro_section_one::intro_section_one()
 {
-    this->m_frames_counter = 0;
+    this->m_ticks_counter = 0;
 
     add_simple_text(
         "Levels 1-10: Numbers",
@@ -202,9 +215,9 @@ void intro_section_one::update()
 {
     level::update();
 
-    ++m_frames_counter;
+    ++m_ticks_counter;
 
-    if (m_frames_counter == 3 * m_game.get_frame_rate()) {
+    if (m_ticks_counter == 3 * m_game.get_tick_rate()) {
         m_game.set_next_level(new level_one());
     }
 }
@@ -244,26 +257,24 @@ level_one::level_one()
         {m_game.get_cw() + 275, m_game.get_ch()}
     };
 
-    // Get a sequence of 4 random numbers, then insert the level number (1) at the beginning.
-    vector<int> button_values = m_game.get_random_sequence(4, m_min_choice, m_max_choice, {1});
-    button_values.insert(button_values.begin(), 1);
+    // Start with the level number (1), then fill the rest with distinct random numbers.
+    array<int, m_choice_count> button_values = {1};
+    m_game.get_random_sequence(span(button_values).subspan(1), m_min_choice, m_max_choice, {1});
 
-    // Get a sequence of 4 random colors, then insert the level number's color (GOLD) at the beginning.
-    vector<Color> button_colors = m_game.get_random_color_sequence(4);
-    button_colors.insert(button_colors.begin(), ORANGE);
+    // Start with the level number's color (ORANGE), then fill the rest with random colors.
+    array<Color, m_choice_count> button_colors = {ORANGE};
+    m_game.get_random_color_sequence(span(button_colors).subspan(1));
     
-    // Ensure all the vectors are constructed to the same proper size.
+    // Ensure the positions are constructed to the same size as the values and colors.
     GAME_ASSERT(
-        (button_positions.size() == m_choice_count) &&
-        (button_values.size() == m_choice_count) &&
-        (button_colors.size() == m_choice_count),
+        button_positions.size() == m_choice_count,
         "Not all button construction vectors are of the class-defined size (m_choice_count)."
     );
 
     // Get 3 iterators for each of these vectors, and *it++ them throughout the loop.
     vector<Vector2>::iterator positions_it = button_positions.begin();
-    vector<int>::iterator values_it = button_values.begin();
-    vector<Color>::iterator colors_it = button_colors.begin();
+    array<int, m_choice_count>::iterator values_it = button_values.begin();
+    array<Color, m_choice_count>::iterator colors_it = button_colors.begin();
    
     // Construct a vector of buttons from which we will choose a correct answer. 
     vector<button*> choosable_buttons(m_choice_count);
@@ -275,7 +286,7 @@ level_one::level_one()
             *colors_it++,
             *positions_it++
         ); 
-		btn->add_trait(new grows_when_hovered());
+		btn->add_trait(grows_when_hovered());
 		choosable_buttons[loop_count] = btn;
     }
 
@@ -294,12 +305,8 @@ void level_one::update()
     if (m_correct_button->is_pressed()) {
         m_game.set_next_level(new level_two());
     }
-    else {
-        for (button* btn : get_buttons()) {
-            if (btn->is_pressed()) {
-                m_game.set_next_level(new level_lose());
-            }
-        }
+    else if (get_pressed_button() != nullptr) {
+        m_game.set_next_level(new level_lose());
     }
 }
 
@@ -339,26 +346,24 @@ level_two::level_two()
         {m_game.get_cw() + 275, m_game.get_ch()}
     };
 
-    // Get a sequence of 4 random numbers, then insert the level number (2) at the beginning.
-    vector<int> button_values = m_game.get_random_sequence(4, m_min_choice, m_max_choice, {2});
-    button_values.insert(button_values.begin(), 2);
+    // Start with the level number (2), then fill the rest with distinct random numbers.
+    array<int, m_choice_count> button_values = {2};
+    m_game.get_random_sequence(span(button_values).subspan(1), m_min_choice, m_max_choice, {2});
 
-    // Get a sequence of 4 random colors, then insert the level number's color at the beginning.
-    vector<Color> button_colors = m_game.get_random_color_sequence(4);
-    button_colors.insert(button_colors.begin(), ORANGE);
+    // Start with the level number's color (ORANGE), then fill the rest with random colors.
+    array<Color, m_choice_count> button_colors = {ORANGE};
+    m_game.get_random_color_sequence(span(button_colors).subspan(1));
     
-    // Ensure all the vectors are constructed to the same proper size.
+    // Ensure the positions are constructed to the same size as the values and colors.
     GAME_ASSERT(
-        (button_positions.size() == m_choice_count) &&
-        (button_values.size() == m_choice_count) &&
-        (button_colors.size() == m_choice_count),
+        button_positions.size() == m_choice_count,
         "Not all button construction vectors are of the class-defined size (m_choice_count)."
     );
 
     // Get 3 iterators for each of these vectors, and *it++ them throughout the loop.
     vector<Vector2>::iterator positions_it = button_positions.begin();
-    vector<int>::iterator values_it = button_values.begin();
-    vector<Color>::iterator colors_it = button_colors.begin();
+    array<int, m_choice_count>::iterator values_it = button_values.begin();
+    array<Color, m_choice_count>::iterator colors_it = button_colors.begin();
    
     // Construct a vector of buttons from which we will choose a correct answer. 
     vector<button*> choosable_buttons(m_choice_count);
@@ -370,7 +375,7 @@ level_two::level_two()
             *colors_it++,
             *positions_it++
         ); 
-		btn->add_trait(new grows_when_hovered());
+		btn->add_trait(grows_when_hovered());
 		choosable_buttons[loop_count] = btn;
     }
 
@@ -389,12 +394,8 @@ void level_two::update()
     if (m_correct_button->is_pressed()) {
         m_game.set_next_level(new level_three());
     }
-    else {
-        for (button* btn : get_buttons()) {
-            if (btn->is_pressed()) {
-                m_game.set_next_level(new level_lose());
-            }
-        }
+    else if (get_pressed_button() != nullptr) {
+        m_game.set_next_level(new level_lose());
     }
 }
 
@@ -424,26 +425,24 @@ level_three::level_three()
         {m_game.get_cw() + 275, m_game.get_ch()}
     };
 
-    // Get a sequence of 4 random numbers, then insert the level number (3) at the beginning.
-    vector<int> button_values = m_game.get_random_sequence(4, m_min_choice, m_max_choice, {3});
-    button_values.insert(button_values.begin(), 3);
+    // Start with the level number (3), then fill the rest with distinct random numbers.
+    array<int, m_choice_count> button_values = {3};
+    m_game.get_random_sequence(span(button_values).subspan(1), m_min_choice, m_max_choice, {3});
 
-    // Get a sequence of 4 random colors, then insert the level number's color (GOLD) at the beginning.
-    vector<Color> button_colors = m_game.get_random_color_sequence(4);
-    button_colors.insert(button_colors.begin(), ORANGE);
+    // Start with the level number's color (ORANGE), then fill the rest with random colors.
+    array<Color, m_choice_count> button_colors = {ORANGE};
+    m_game.get_random_color_sequence(span(button_colors).subspan(1));
     
-    // Ensure all the vectors are constructed to the same proper size.
+    // Ensure the positions are constructed to the same size as the values and colors.
     GAME_ASSERT(
-        (button_positions.size() == m_choice_count) &&
-        (button_values.size() == m_choice_count) &&
-        (button_colors.size() == m_choice_count),
+        button_positions.size() == m_choice_count,
         "Not all button construction vectors are of the class-defined size (m_choice_count)."
     );
 
     // Get 3 iterators for each of these vectors, and *it++ them throughout the loop.
     vector<Vector2>::iterator positions_it = button_positions.begin();
-    vector<int>::iterator values_it = button_values.begin();
-    vector<Color>::iterator colors_it = button_colors.begin();
+    array<int, m_choice_count>::iterator values_it = button_values.begin();
+    array<Color, m_choice_count>::iterator colors_it = button_colors.begin();
    
     // Choose a random iteration to be the correct 'growing' number.
     size_t chosen_loop_count = m_game.get_random_value(0, m_choice_count - 1);
@@ -458,10 +457,10 @@ level_three::level_three()
 
 		if (loop_count == chosen_loop_count) {
 			m_correct_button = btn;
-			m_correct_button->add_trait(new grows_when_hovered(20, 2.5f));
+			m_correct_button->add_trait(grows_when_hovered(20, 2.5f));
 		}
 		else {
-			btn->add_trait(new grows_when_hovered());
+			btn->add_trait(grows_when_hovered());
 		}
     }	
 }
@@ -473,12 +472,8 @@ void level_three::update()
     if (m_correct_button->is_pressed()) {
         m_game.set_next_level(new level_four());
     }
-    else {
-        for (button* btn : get_buttons()) {
-            if (btn->is_pressed()) {
-                m_game.set_next_level(new level_lose());
-            }
-        }
+    else if (get_pressed_button() != nullptr) {
+        m_game.set_next_level(new level_lose());
     }
 }
 
@@ -534,7 +529,7 @@ level_four::level_four()
     );
 
     for (button* btn : get_buttons()) {
-        btn->add_trait(new grows_when_hovered());
+        btn->add_trait(grows_when_hovered());
     }
 }
 
@@ -542,12 +537,10 @@ void level_four::update()
 {
     level::update();
 
-    for (button* btn : get_buttons()) {
-        if (btn->is_pressed()) {
-            string chosen_time = btn->get_text();
-            chosen_time.erase(chosen_time.find(" seconds"), chosen_time.length());
-            m_game.set_next_level(new level_five(chosen_time));
-        }
+    if (button* const btn = get_pressed_button()) {
+        string chosen_time = btn->get_text();
+        chosen_time.erase(chosen_time.find(" seconds"), chosen_time.length());
+        m_game.set_next_level(new level_five(chosen_time));
     }
 }
 
@@ -556,7 +549,7 @@ void level_four::update()
 // ------------------------------------------------------------------------------------------ //
 level_five::level_five(string duration)
 {
-    this->m_frames_counter = 0;
+    this->m_ticks_counter = 0;
     this->m_duration = duration;
     this->m_timer = add_text_button(
         m_duration,
@@ -711,12 +704,12 @@ void level_five::update()
 
     bool level_lost = false;
 
-    // update the timer once per 60 frames.
-    m_frames_counter++; 
-    if (m_frames_counter == 60) {
+    // update the timer once per second of ticks.
+    m_ticks_counter++; 
+    if (m_ticks_counter == m_game.get_tick_rate()) {
         int duration_as_int = stoi(m_duration);
         if (duration_as_int > 0) {
-            m_frames_counter = 0;
+            m_ticks_counter = 0;
             --duration_as_int;
             
             m_duration = to_string(duration_as_int);
@@ -728,10 +721,8 @@ void level_five::update()
     }
 
     // The player will lose if any button is hovered, or if the window (game) becomes unfocused.
-    for (button* btn : get_buttons()) {
-        if (btn->is_hovered()) {
-            level_lost = true;    
-        }
+    if (get_hovered_button() != nullptr) {
+        level_lost = true;
     }
 
     if (!m_game.mouse_in_canvas()) {
@@ -748,7 +739,7 @@ void level_five::update()
 // ------------------------------------------------------------------------------------------ //
 level_six::level_six()
 {
-    this->m_frames_counter = 0;
+    this->m_ticks_counter = 0;
 
     //
     // Main UI elements (level title, directions).
@@ -789,26 +780,24 @@ level_six::level_six()
         {m_game.get_cw() + 275, m_game.get_ch()}
     };
 
-    // Get a sequence of 4 random numbers, then insert the level number (6) at the beginning.
-    vector<int> button_values = m_game.get_random_sequence(m_choice_count - 1, m_min_choice, m_max_choice, {6});
-    button_values.insert(button_values.begin(), 6);
+    // Start with the level number (6), then fill the rest with distinct random numbers.
+    array<int, m_choice_count> button_values = {6};
+    m_game.get_random_sequence(span(button_values).subspan(1), m_min_choice, m_max_choice, {6});
 
-    // Get a sequence of 4 random colors, then insert the level number's color (ORANGE) at the beginning.
-    vector<Color> button_colors = m_game.get_random_color_sequence(m_choice_count - 1);
-    button_colors.insert(button_colors.begin(), ORANGE);
+    // Start with the level number's color (ORANGE), then fill the rest with random colors.
+    array<Color, m_choice_count> button_colors = {ORANGE};
+    m_game.get_random_color_sequence(span(button_colors).subspan(1));
     
-    // Ensure all the vectors are constructed to the same proper size.
+    // Ensure the positions are constructed to the same size as the values and colors.
     GAME_ASSERT(
-        (button_positions.size() == m_choice_count) &&
-        (button_values.size() == m_choice_count) &&
-        (button_colors.size() == m_choice_count),
+        button_positions.size() == m_choice_count,
         "Not all button construction vectors are of the class-defined size (m_choice_count)."
     );
 
     // Get 3 iterators for each of these vectors, and *it++ them throughout the loop.
     vector<Vector2>::iterator positions_it = button_positions.begin();
-    vector<int>::iterator values_it = button_values.begin();
-    vector<Color>::iterator colors_it = button_colors.begin();
+    array<int, m_choice_count>::iterator values_it = button_values.begin();
+    array<Color, m_choice_count>::iterator colors_it = button_colors.begin();
    
     for (size_t loop_count = 0; loop_count != m_choice_count; ++loop_count) {
         add_text_button(
@@ -820,7 +809,7 @@ level_six::level_six()
     } 
 
 	for (button* btn : get_buttons()) {
-		btn->add_trait(new grows_when_hovered());
+		btn->add_trait(grows_when_hovered());
 	}
 }
 
@@ -829,23 +818,23 @@ void level_six::update()
     level::update();
 
 
-    if (m_correct_button->get_position().x >= m_game.get_cw() && m_frames_counter < 60) {
+    // Hold the '3' in the center of the screen for one second.
+    if (m_correct_button->get_position().x >= m_game.get_cw() &&
+        m_ticks_counter < m_game.get_tick_rate()) {
         m_correct_button->set_speed({0, 0});
-        ++m_frames_counter;
+        ++m_ticks_counter;
     }
 
-    if (m_frames_counter == 60) {
+    if (m_ticks_counter == m_game.get_tick_rate()) {
         m_correct_button->set_speed({20, 0});
     }
 
-    for (button* btn : get_buttons()) {
-        if (btn->is_pressed()) {
-            if (btn == m_correct_button) {
-                m_game.set_next_level(new level_seven());
-            }
-            else {
-                m_game.set_next_level(new level_lose());
-            }
+    if (button* const btn = get_pressed_button()) {
+        if (btn == m_correct_button) {
+            m_game.set_next_level(new level_seven());
+        }
+        else {
+            m_game.set_next_level(new level_lose());
         }
     }
 
@@ -892,27 +881,24 @@ level_seven::level_seven()
         {m_game.get_cw() + 275, m_game.get_ch()}
     };
 
-    // Get a sequence of 4 random numbers, then insert the level number (9), then (7) at the beginning.
-    vector<int> button_values = m_game.get_random_sequence(m_choice_count - 2, 1, 8, {7});
-    button_values.insert(button_values.begin(), 9);
-    button_values.insert(button_values.begin(), 7);
+    // Start with the level number (7), then (9), then fill the rest with distinct random numbers.
+    array<int, m_choice_count> button_values = {7, 9};
+    m_game.get_random_sequence(span(button_values).subspan(2), 1, 8, {7});
 
-    // Get a sequence of 4 random colors, then insert the level number's color (GOLD) at the beginning.
-    vector<Color> button_colors = m_game.get_random_color_sequence(m_choice_count - 1);
-    button_colors.insert(button_colors.begin(), ORANGE);
+    // Start with the level number's color (ORANGE), then fill the rest with random colors.
+    array<Color, m_choice_count> button_colors = {ORANGE};
+    m_game.get_random_color_sequence(span(button_colors).subspan(1));
     
-    // Ensure all the vectors are constructed to the same proper size.
+    // Ensure the positions are constructed to the same size as the values and colors.
     GAME_ASSERT(
-        (button_positions.size() == m_choice_count) &&
-        (button_values.size() == m_choice_count) &&
-        (button_colors.size() == m_choice_count),
+        button_positions.size() == m_choice_count,
         "Not all button construction vectors are of the class-defined size (m_choice_count)."
     );
 
     // Get 3 iterators for each of these vectors, and *it++ them throughout the loop.
     vector<Vector2>::iterator positions_it = button_positions.begin();
-    vector<int>::iterator values_it = button_values.begin();
-    vector<Color>::iterator colors_it = button_colors.begin();
+    array<int, m_choice_count>::iterator values_it = button_values.begin();
+    array<Color, m_choice_count>::iterator colors_it = button_colors.begin();
     
     m_button_seven = add_text_button(
         to_string(*values_it++),
@@ -938,8 +924,8 @@ level_seven::level_seven()
     }
 
 	for (button* btn : get_buttons()) {
-		btn->add_trait(new grows_when_hovered());
-		btn->add_trait(new grabbable());
+		btn->add_trait(grows_when_hovered());
+		btn->add_trait(grabbable());
 	}
 }
 
@@ -950,26 +936,23 @@ void level_seven::update()
     button* button_in_hand = m_game.get_button_in_hand();
 
     if (button_in_hand != nullptr) {
-        for (button* btn : get_buttons()) {
-            const bool two_buttons_collided = (
-                btn != button_in_hand &&
-                CheckCollisionRecs(button_in_hand->get_scaled_rec(), btn->get_scaled_rec())
+        for_each_button_in(button_in_hand->get_scaled_rec(), [this, button_in_hand](button* btn) {
+            if (btn == button_in_hand) {
+                return;
+            }
+
+            const bool seven_and_nine_collided = (
+                (button_in_hand == m_button_seven && btn == m_button_nine) ||
+                (button_in_hand == m_button_nine && btn == m_button_seven)
             );
 
-            if (two_buttons_collided) {
-                const bool seven_and_nine_collided = (
-                    (button_in_hand == m_button_seven && btn == m_button_nine) ||
-                    (button_in_hand == m_button_nine && btn == m_button_seven)
-                );
-
-                if (seven_and_nine_collided) {
-                    m_game.set_next_level(new level_eight());
-                }
-                else {
-                    m_game.set_next_level(new level_lose());
-                }
+            if (seven_and_nine_collided) {
+                m_game.set_next_level(new level_eight());
             }
-        }
+            else {
+                m_game.set_next_level(new level_lose());
+            }
+        });
     }
 }
 
@@ -1059,30 +1042,27 @@ level_eight::level_eight()
     const int min_choice = 10;
     const int max_choice = 99;
 
-    vector<int> button_values = m_game.get_random_sequence(
-        m_choice_count - 2,
+    array<int, m_choice_count> button_values = {8, correct_value};
+    m_game.get_random_sequence(
+        span(button_values).subspan(2),
         min_choice,
         max_choice,
         {correct_value}
     );
-    button_values.insert(button_values.begin(), correct_value);
-    button_values.insert(button_values.begin(), 8);
 
-    vector<Color> button_colors = m_game.get_random_color_sequence(m_choice_count - 1);
-    button_colors.insert(button_colors.begin(), ORANGE);
+    array<Color, m_choice_count> button_colors = {ORANGE};
+    m_game.get_random_color_sequence(span(button_colors).subspan(1));
     
-    // Ensure all the vectors are constructed to the same proper size.
+    // Ensure the positions are constructed to the same size as the values and colors.
     GAME_ASSERT(
-        (button_positions.size() == m_choice_count) &&
-        (button_values.size() == m_choice_count) &&
-        (button_colors.size() == m_choice_count),
+        button_positions.size() == m_choice_count,
         "Not all button construction vectors are of the class-defined size (m_choice_count)."
     );
 
     // Get 3 iterators for each of these vectors, and *it++ them throughout the loop.
     vector<Vector2>::iterator positions_it = button_positions.begin();
-    vector<int>::iterator values_it = button_values.begin();
-    vector<Color>::iterator colors_it = button_colors.begin();
+    array<int, m_choice_count>::iterator values_it = button_values.begin();
+    array<Color, m_choice_count>::iterator colors_it = button_colors.begin();
 
     size_t buttons_created = 0;
 
@@ -1116,7 +1096,7 @@ level_eight::level_eight()
     }
 
 	for (button* btn : get_buttons()) {
-		btn->add_trait(new grows_when_hovered());
+		btn->add_trait(grows_when_hovered());
 	}
 }
 
@@ -1127,12 +1107,8 @@ void level_eight::update()
     if (m_correct_button->is_pressed()) {
         m_game.set_next_level(new level_nine());
     }
-    else {
-        for (button* btn : get_buttons()) {
-            if (btn->is_pressed()) {
-                m_game.set_next_level(new level_lose());
-            }
-        }
+    else if (get_pressed_button() != nullptr) {
+        m_game.set_next_level(new level_lose());
     }
 }
 
@@ -1162,7 +1138,7 @@ level_nine::level_nine()
     ->add_anim_rotate(0.0f, 4.0f, 1.5f);
 
     this->m_submit_box = add_entity(
-        new label(
+        new (m_arena) label(
             BLACK,
             WHITE,
             {250, 150},
@@ -1187,26 +1163,24 @@ level_nine::level_nine()
         {m_game.get_cw() + 275, m_game.get_ch()}
     };
 
-    // Get a sequence of 4 random numbers, then insert the level number (9) at the beginning.
-    vector<int> button_values = m_game.get_random_sequence(4, 1, 8, {9});
-    button_values.insert(button_values.begin(), 9);
+    // Start with the level number (9), then fill the rest with distinct random numbers.
+    array<int, m_choice_count> button_values = {9};
+    m_game.get_random_sequence(span(button_values).subspan(1), 1, 8, {9});
 
-    // Get a sequence of 4 random colors, then insert the level number's color (GOLD) at the beginning.
-    vector<Color> button_colors = m_game.get_random_color_sequence(4);
-    button_colors.insert(button_colors.begin(), ORANGE);
+    // Start with the level number's color (ORANGE), then fill the rest with random colors.
+    array<Color, m_choice_count> button_colors = {ORANGE};
+    m_game.get_random_color_sequence(span(button_colors).subspan(1));
     
-    // Ensure all the vectors are constructed to the same proper size.
+    // Ensure the positions are constructed to the same size as the values and colors.
     GAME_ASSERT(
-        (button_positions.size() == m_choice_count) &&
-        (button_values.size() == m_choice_count) &&
-        (button_colors.size() == m_choice_count),
+        button_positions.size() == m_choice_count,
         "Not all button construction vectors are of the class-defined size (m_choice_count)."
     );
 
     // Get 3 iterators for each of these vectors, and *it++ them throughout the loop.
     vector<Vector2>::iterator positions_it = button_positions.begin();
-    vector<int>::iterator values_it = button_values.begin();
-    vector<Color>::iterator colors_it = button_colors.begin();
+    array<int, m_choice_count>::iterator values_it = button_values.begin();
+    array<Color, m_choice_count>::iterator colors_it = button_colors.begin();
 
     while (m_correct_button_layout.size() < m_choice_count) {
         button* btn = add_text_button(
@@ -1215,8 +1189,8 @@ level_nine::level_nine()
             *colors_it++,
             *positions_it++
         );
-		btn->add_trait(new grows_when_hovered());
-		btn->add_trait(new grabbable());
+		btn->add_trait(grows_when_hovered());
+		btn->add_trait(grabbable());
         m_correct_button_layout.push_back(btn);
     }
     
@@ -1242,15 +1216,10 @@ void level_nine::update()
         vector<button*> numbers_in_box; // For buttons that are inside of the submission box.
         numbers_in_box.reserve(m_choice_count);
 
-        for (button* btn : get_buttons()) {
-            if (CheckCollisionRecs(btn->get_scaled_rec(), m_submit_box->get_rectangle())) {
-                vector<button*>::iterator it = numbers_in_box.begin();
-                while (it != numbers_in_box.end() && (*it)->get_position().x <= btn->get_position().x) {
-                    ++it;
-                }
-                numbers_in_box.insert(it, btn);
-            }
-        }
+        for_each_button_in(m_submit_box->get_rectangle(), [&numbers_in_box](button* btn) {
+            numbers_in_box.push_back(btn);
+        });
+        sort_by_position_x(numbers_in_box);
 
         // Assume true and override if proven false. 
         bool answer_was_chosen = true;
@@ -1305,14 +1274,14 @@ level_ten::level_ten()
 
     Vector2 const submit_box_position = {m_game.get_cw(), m_game.get_ch() - 25};
     this->m_submit_box = add_entity(
-        new button(
-            new text("", 80, BLACK, submit_box_position, 0, {0, 0, 0, 0}, 0.0f),
+        new (m_arena) button(
+            new (m_arena) text("", 80, BLACK, submit_box_position, 0, {0, 0, 0, 0}, 0.0f),
             WHITE,
             {submit_box_position.x - 125.0f, submit_box_position.y - 75.0f, 250.0f, 150.0f},
             0
         )
     );
-    m_submit_box->add_trait(new grabbable());
+    m_submit_box->add_trait(grabbable());
 
     this->m_submit_button = add_ui_button("Submit");
 
@@ -1329,32 +1298,30 @@ level_ten::level_ten()
         {m_game.get_cw() + 275, m_game.get_ch()}
     };
 
-    // Get a sequence of 4 random numbers, sort them greatest to least, then insert the level
-    // number (10) at the beginning.
-    vector<int> button_values = m_game.get_random_sequence(4, 1, 99, {10});
-    sort(button_values.begin(), button_values.end(),
+    // Start with the level number (10), then fill the rest with distinct random numbers,
+    // sorted least to greatest.
+    array<int, m_choice_count> button_values = {10};
+    m_game.get_random_sequence(span(button_values).subspan(1), 1, 99, {10});
+    std::sort(button_values.begin() + 1, button_values.end(),
         [](int a, int b) {
             return a < b;
         }
     );
-    button_values.insert(button_values.begin(), 10);
 
-    // Get a sequence of 4 random colors, then insert the level number's color (GOLD) at the beginning.
-    vector<Color> button_colors = m_game.get_random_color_sequence(4);
-    button_colors.insert(button_colors.begin(), ORANGE);
+    // Start with the level number's color (ORANGE), then fill the rest with random colors.
+    array<Color, m_choice_count> button_colors = {ORANGE};
+    m_game.get_random_color_sequence(span(button_colors).subspan(1));
     
-    // Ensure all the vectors are constructed to the same proper size.
+    // Ensure the positions are constructed to the same size as the values and colors.
     GAME_ASSERT(
-        (button_positions.size() == m_choice_count) &&
-        (button_values.size() == m_choice_count) &&
-        (button_colors.size() == m_choice_count),
+        button_positions.size() == m_choice_count,
         "Not all button construction vectors are of the class-defined size (m_choice_count)."
     );
 
     // Get 3 iterators for each of these vectors, and *it++ them throughout the loop.
     vector<Vector2>::iterator positions_it = button_positions.begin();
-    vector<int>::iterator values_it = button_values.begin();
-    vector<Color>::iterator colors_it = button_colors.begin(); 
+    array<int, m_choice_count>::iterator values_it = button_values.begin();
+    array<Color, m_choice_count>::iterator colors_it = button_colors.begin(); 
 
     while (m_correct_button_layout.size() < m_choice_count) {
         button* btn = add_text_button(
@@ -1376,7 +1343,7 @@ level_ten::level_ten()
             Vector2 ice_cube_position = *positions_it;
             ice_cube_position.x += 4;   // Accomodate for the shadow offset of the text.
             add_entity(
-                new label(
+                new (m_arena) label(
                     {255, 255, 255, 75},
                     {75, 150, 255, 75},
                     ice_cube_size,
@@ -1387,8 +1354,8 @@ level_ten::level_ten()
             );
         }
         else {
-            btn->add_trait(new grows_when_hovered());
-            btn->add_trait(new grabbable());
+            btn->add_trait(grows_when_hovered());
+            btn->add_trait(grabbable());
         }
 
         ++colors_it;
@@ -1419,16 +1386,12 @@ void level_ten::update()
         vector<button*> numbers_in_box; // For buttons that are inside of the submission box.
         numbers_in_box.reserve(m_choice_count);
 
-        for (button* btn : get_buttons()) {
-            if (btn == m_submit_button || btn == m_submit_box) { continue; }
-            if (CheckCollisionRecs(btn->get_scaled_rec(), m_submit_box->get_scaled_rec())) {
-                vector<button*>::iterator it = numbers_in_box.begin();
-                while (it != numbers_in_box.end() && (*it)->get_position().x <= btn->get_position().x) {
-                    ++it;
-                }
-                numbers_in_box.insert(it, btn);
+        for_each_button_in(m_submit_box->get_scaled_rec(), [this, &numbers_in_box](button* btn) {
+            if (btn != m_submit_button && btn != m_submit_box) {
+                numbers_in_box.push_back(btn);
             }
-        }
+        });
+        sort_by_position_x(numbers_in_box);
 
         // Assume true and override if proven false. 
         bool answer_was_chosen = true;
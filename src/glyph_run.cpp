@@ -0,0 +1,327 @@
+/***********************************************************************************************
+*
+*   glyph_run.cpp - A line of text decoded and placed once, then drawn glyph by glyph.
+*
+*   Copyright (c) 2025 Josh Hayden (@BlinkDynamo)
+*
+*   Blink's Thinks is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License v3.0 as published
+*   by the Free Software Foundation.
+*
+*   Blink's Thinks is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*
+***********************************************************************************************/
+
+// Source.
+#include "glyph_run.hpp"
+#include "game.hpp"
+
+// Raylib.
+#include "rlgl.h"
+
+// Standard library.
+#include <algorithm>
+
+using engine::glyph_run;
+using engine::glyph_mesh;
+
+glyph_run::glyph_run()
+    :
+    m_font{},
+    m_font_size(0.0f),
+    m_glyphs()
+{}
+
+void glyph_run::build(Font font, const std::string& text_str, float font_size, float spacing)
+{
+    m_font = font;
+    m_font_size = font_size;
+    m_glyphs.clear();
+
+    const bool has_glyphs = (font.texture.id != 0);
+    const float scale_factor = font_size / (has_glyphs ? font.baseSize : m_default_font_base_size);
+    const float padding = has_glyphs ? font.glyphPadding : 0.0f;
+
+    float pen_x = 0.0f;
+    for (size_t i = 0; i < text_str.size();) {
+        int codepoint_size = 0;
+        const int codepoint = GetCodepointNext(text_str.c_str() + i, &codepoint_size);
+        i += codepoint_size;
+
+        glyph g = { {}, {}, pen_x, 0.0f };
+
+        if (has_glyphs) {
+            const int index = GetGlyphIndex(font, codepoint);
+            const Rectangle rec = font.recs[index];
+            const GlyphInfo& info = font.glyphs[index];
+
+            g.advance = (info.advanceX != 0 ? info.advanceX : rec.width) * scale_factor;
+
+            // Placed like 'DrawTextCodepoint()', with the atlas padding around the glyph.
+            if (codepoint != ' ' && codepoint != '\t') {
+                g.source = {
+                    rec.x - padding,
+                    rec.y - padding,
+                    rec.width + 2.0f * padding,
+                    rec.height + 2.0f * padding
+                };
+                g.dest = {
+                    pen_x + (info.offsetX - padding) * scale_factor,
+                    (info.offsetY - padding) * scale_factor,
+                    g.source.width * scale_factor,
+                    g.source.height * scale_factor
+                };
+            }
+        }
+        else if (codepoint >= m_default_font_first_char && codepoint <= m_default_font_last_char) {
+            g.advance = m_default_font_glyph_widths[codepoint - m_default_font_first_char] * scale_factor;
+        }
+
+        m_glyphs.push_back(g);
+        pen_x += g.advance + spacing;
+    }
+}
+
+Vector2 glyph_run::get_size(size_t count)
+{
+    count = std::min(count, m_glyphs.size());
+    if (count == 0) {
+        return { 0.0f, m_font_size };
+    }
+
+    const glyph& last = m_glyphs[count - 1];
+    return { last.pen_x + last.advance, m_font_size };
+}
+
+void glyph_run::draw(Vector2 position, Vector2 origin, float rotation, float scale, Color tint,
+                     size_t first, size_t count)
+{
+    const size_t last = std::min(m_glyphs.size(), first + std::min(count, m_glyphs.size()));
+
+    for (size_t i = first; i < last; ++i) {
+        const glyph& g = m_glyphs[i];
+        if (g.source.width == 0.0f) {
+            continue;
+        }
+
+        // Each quad is rotated about the run's origin, given from the quad's own top left.
+        const Rectangle dest = { position.x, position.y, g.dest.width * scale, g.dest.height * scale };
+        const Vector2 quad_origin = { origin.x - g.dest.x * scale, origin.y - g.dest.y * scale };
+        DrawTexturePro(m_font.texture, g.source, dest, quad_origin, rotation, tint);
+    }
+}
+
+glyph_mesh::glyph_mesh()
+    :
+    m_mesh{},
+    m_capacity(0),
+    m_quad_count(0),
+    m_spans(),
+    m_bounds{},
+    m_visible_first(0),
+    m_visible_count(0),
+    m_index_shift(SIZE_MAX),
+    m_vertices(),
+    m_texcoords(),
+    m_indices()
+{}
+
+glyph_mesh::~glyph_mesh()
+{
+    unload();
+}
+
+void glyph_mesh::unload()
+{
+    if (m_capacity == 0) {
+        return;
+    }
+
+    // The arrays belong to the vectors, so raylib is only left the buffers to free.
+    m_mesh.vertices = nullptr;
+    m_mesh.texcoords = nullptr;
+    m_mesh.indices = nullptr;
+    UnloadMesh(m_mesh);
+    m_mesh = {};
+    m_capacity = 0;
+}
+
+void glyph_mesh::bake(glyph_run& run)
+{
+    const Texture2D texture = run.m_font.texture;
+
+    m_vertices.clear();
+    m_texcoords.clear();
+    m_spans.clear();
+    float top = 0.0f;
+    float bottom = 0.0f;
+    if (texture.id != 0) {
+        for (const glyph_run::glyph& g : run.m_glyphs) {
+            if (g.source.width == 0.0f) {
+                continue;
+            }
+
+            // Quads past what the indices can reach are left out, rather than drawn from the
+            // wrong vertices.
+            GAME_ASSERT(m_spans.size() < m_max_quads, "Too many glyphs for one mesh.");
+            if (m_spans.size() == m_max_quads) {
+                break;
+            }
+
+            const float x0 = g.dest.x;
+            const float y0 = g.dest.y;
+            const float x1 = g.dest.x + g.dest.width;
+            const float y1 = g.dest.y + g.dest.height;
+            const float u0 = g.source.x / texture.width;
+            const float v0 = g.source.y / texture.height;
+            const float u1 = (g.source.x + g.source.width) / texture.width;
+            const float v1 = (g.source.y + g.source.height) / texture.height;
+
+            // Top left, bottom left, bottom right and top right, wound like raylib's own quads.
+            m_vertices.insert(m_vertices.end(), { x0, y0, 0.0f, x0, y1, 0.0f, x1, y1, 0.0f, x1, y0, 0.0f });
+            m_texcoords.insert(m_texcoords.end(), { u0, v0, u0, v1, u1, v1, u1, v0 });
+
+            m_spans.push_back({ x0, x1 });
+            top = m_spans.size() == 1 ? y0 : std::min(top, y0);
+            bottom = m_spans.size() == 1 ? y1 : std::max(bottom, y1);
+        }
+    }
+
+    const size_t quads = m_spans.size();
+    m_quad_count = quads;
+    m_bounds = {};
+    if (quads > 0) {
+        float left = m_spans[0].left;
+        float right = m_spans[0].right;
+        for (const span& sp : m_spans) {
+            left = std::min(left, sp.left);
+            right = std::max(right, sp.right);
+        }
+        m_bounds = { left, top, right - left, bottom - top };
+    }
+
+    if (quads > m_capacity) {
+        unload();
+
+        m_indices.clear();
+        for (size_t q = 0; q < quads; ++q) {
+            const unsigned short first = q * 4;
+            m_indices.insert(m_indices.end(), {
+                first, static_cast<unsigned short>(first + 1), static_cast<unsigned short>(first + 2),
+                first, static_cast<unsigned short>(first + 2), static_cast<unsigned short>(first + 3)
+            });
+        }
+
+        m_mesh.vertexCount = quads * 4;
+        m_mesh.triangleCount = quads * 2;
+        m_mesh.vertices = m_vertices.data();
+        m_mesh.texcoords = m_texcoords.data();
+        m_mesh.indices = m_indices.data();
+        UploadMesh(&m_mesh, true);
+        m_capacity = quads;
+        m_index_shift = 0;
+    }
+    else if (quads > 0) {
+        UpdateMeshBuffer(m_mesh, 0, m_vertices.data(), m_vertices.size() * sizeof(float), 0);
+        UpdateMeshBuffer(m_mesh, 1, m_texcoords.data(), m_texcoords.size() * sizeof(float), 0);
+
+        // The uploaded indices may stop short of the new quads.
+        m_index_shift = SIZE_MAX;
+    }
+
+    m_visible_first = 0;
+    m_visible_count = 0;
+}
+
+size_t glyph_mesh::cull(Matrix transform, Rectangle viewport)
+{
+    m_visible_first = 0;
+    m_visible_count = 0;
+    if (m_quad_count == 0) {
+        return 0;
+    }
+
+    // The 2D part of 'transform': 'x' = 'a' * x + 'b' * y + 'tx', 'y' = 'c' * x + 'd' * y + 'ty'.
+    const float a = transform.m0;
+    const float b = transform.m4;
+    const float c = transform.m1;
+    const float d = transform.m5;
+    const float tx = transform.m12;
+    const float ty = transform.m13;
+
+    // The whole mesh, when the box around its transformed bounds misses the viewport.
+    const float bounds_xs[4] = { m_bounds.x, m_bounds.x + m_bounds.width, m_bounds.x, m_bounds.x + m_bounds.width };
+    const float bounds_ys[4] = { m_bounds.y, m_bounds.y, m_bounds.y + m_bounds.height, m_bounds.y + m_bounds.height };
+    float min_x = a * bounds_xs[0] + b * bounds_ys[0] + tx;
+    float max_x = min_x;
+    float min_y = c * bounds_xs[0] + d * bounds_ys[0] + ty;
+    float max_y = min_y;
+    for (int i = 1; i < 4; ++i) {
+        const float x = a * bounds_xs[i] + b * bounds_ys[i] + tx;
+        const float y = c * bounds_xs[i] + d * bounds_ys[i] + ty;
+        min_x = std::min(min_x, x);
+        max_x = std::max(max_x, x);
+        min_y = std::min(min_y, y);
+        max_y = std::max(max_y, y);
+    }
+
+    if (max_x < viewport.x || min_x > viewport.x + viewport.width ||
+        max_y < viewport.y || min_y > viewport.y + viewport.height) {
+        return 0;
+    }
+
+    const float det = a * d - b * c;
+    if (det == 0.0f) {
+        return 0;
+    }
+
+    // The viewport in the mesh's own space. Only how far it reaches left and right is used, as
+    // the quads run along a line.
+    const float view_xs[4] = { viewport.x, viewport.x + viewport.width, viewport.x, viewport.x + viewport.width };
+    const float view_ys[4] = { viewport.y, viewport.y, viewport.y + viewport.height, viewport.y + viewport.height };
+    float view_left = 0.0f;
+    float view_right = 0.0f;
+    for (int i = 0; i < 4; ++i) {
+        const float x = (d * (view_xs[i] - tx) - b * (view_ys[i] - ty)) / det;
+        view_left = (i == 0) ? x : std::min(view_left, x);
+        view_right = (i == 0) ? x : std::max(view_right, x);
+    }
+
+    size_t first = 0;
+    while (first < m_quad_count && m_spans[first].right < view_left) {
+        ++first;
+    }
+
+    size_t last = m_quad_count;
+    while (last > first && m_spans[last - 1].left > view_right) {
+        --last;
+    }
+
+    m_visible_first = first;
+    m_visible_count = last - first;
+    return m_visible_count;
+}
+
+void glyph_mesh::draw(const Material& material, Matrix transform)
+{
+    if (m_visible_count == 0) {
+        return;
+    }
+
+    if (m_index_shift != m_visible_first) {
+        const unsigned short* indices = m_indices.data() + m_visible_first * 6;
+        const size_t count = (m_quad_count - m_visible_first) * 6;
+        rlUpdateVertexBufferElements(m_mesh.vboId[m_index_buffer], indices, count * sizeof(unsigned short), 0);
+        m_index_shift = m_visible_first;
+    }
+
+    rlDrawRenderBatchActive();
+    m_mesh.triangleCount = m_visible_count * 2;
+    DrawMesh(m_mesh, material, transform);
+}
@@ -0,0 +1,144 @@
+/***********************************************************************************************
+*
+*   input.cpp - The input state seen by each simulation tick, and its recording and replay.
+*
+*   Copyright (c) 2025 Josh Hayden (@BlinkDynamo)
+*
+*   Blink's Thinks is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License v3.0 as published
+*   by the Free Software Foundation.
+*
+*   Blink's Thinks is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*
+***********************************************************************************************/
+
+// Source.
+#include "input.hpp"
+
+// Standard library.
+#include <cstring>
+
+using engine::input_state;
+using engine::input_log;
+
+namespace
+{
+    // Every supported target is little endian, so values are written in native byte order.
+    template <typename T>
+    void write_value(std::ofstream& out, T value)
+    {
+        out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template <typename T>
+    bool read_value(std::ifstream& in, T& value)
+    {
+        return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+    }
+}
+
+bool input_log::start_recording(const string& path, unsigned int seed, size_t tick_rate)
+{
+    m_out.open(path, std::ios::binary | std::ios::trunc);
+    if (!m_out.is_open()) {
+        TraceLog(LOG_ERROR, "[%s] Could not open '%s' for writing.", __PRETTY_FUNCTION__, path.c_str());
+        return false;
+    }
+
+    m_seed = seed;
+    m_tick_rate = tick_rate;
+
+    m_out.write(m_magic, sizeof(m_magic));
+    write_value<uint32_t>(m_out, m_version);
+    write_value<uint32_t>(m_out, m_seed);
+    write_value<uint32_t>(m_out, m_tick_rate);
+    return true;
+}
+
+bool input_log::start_replay(const string& path)
+{
+    m_in.open(path, std::ios::binary);
+    if (!m_in.is_open()) {
+        TraceLog(LOG_ERROR, "[%s] Could not open '%s' for reading.", __PRETTY_FUNCTION__, path.c_str());
+        return false;
+    }
+
+    char magic[sizeof(m_magic)];
+    uint32_t version = 0;
+    uint32_t seed = 0;
+    uint32_t tick_rate = 0;
+
+    const bool header_read = (
+        m_in.read(magic, sizeof(magic)) &&
+        read_value(m_in, version) &&
+        read_value(m_in, seed) &&
+        read_value(m_in, tick_rate)
+    );
+
+    if (!header_read || std::memcmp(magic, m_magic, sizeof(m_magic)) != 0 || version != m_version) {
+        TraceLog(LOG_ERROR, "[%s] '%s' is not a version %u input log.", __PRETTY_FUNCTION__, path.c_str(), m_version);
+        m_in.close();
+        return false;
+    }
+
+    m_seed = seed;
+    m_tick_rate = tick_rate;
+    return true;
+}
+
+void input_log::write(const input_state& input)
+{
+    write_value<float>(m_out, input.mouse_position.x);
+    write_value<float>(m_out, input.mouse_position.y);
+    write_value<uint8_t>(m_out, input.mouse_buttons_down);
+    write_value<uint8_t>(m_out, input.mouse_buttons_pressed);
+    write_value<uint8_t>(m_out, input.in_canvas);
+    write_value<uint8_t>(m_out, input.key_count);
+
+    for (size_t i = 0; i < input.key_count; ++i) {
+        write_value<uint16_t>(m_out, input.keys_pressed[i]);
+    }
+}
+
+bool input_log::read(input_state& input)
+{
+    uint8_t buttons_down = 0;
+    uint8_t buttons_pressed = 0;
+    uint8_t in_canvas = 0;
+    uint8_t key_count = 0;
+
+    const bool tick_read = (
+        read_value(m_in, input.mouse_position.x) &&
+        read_value(m_in, input.mouse_position.y) &&
+        read_value(m_in, buttons_down) &&
+        read_value(m_in, buttons_pressed) &&
+        read_value(m_in, in_canvas) &&
+        read_value(m_in, key_count) &&
+        key_count <= input_state::max_keys
+    );
+
+    if (!tick_read) {
+        return false;
+    }
+
+    input.mouse_buttons_down = buttons_down;
+    input.mouse_buttons_pressed = buttons_pressed;
+    input.in_canvas = in_canvas != 0;
+    input.key_count = key_count;
+
+    for (size_t i = 0; i < input.key_count; ++i) {
+        uint16_t key = 0;
+        if (!read_value(m_in, key)) {
+            return false;
+        }
+        input.keys_pressed[i] = key;
+    }
+
+    return true;
+}
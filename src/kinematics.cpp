@@ -0,0 +1,100 @@
+/***********************************************************************************************
+*
+*   kinematics.cpp - Struct-of-arrays storage and integration of entity motion.
+*
+*   Copyright (c) 2025 Josh Hayden (@BlinkDynamo)
+*
+*   Blink's Thinks is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License v3.0 as published
+*   by the Free Software Foundation.
+*
+*   Blink's Thinks is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*
+***********************************************************************************************/
+
+// Source.
+#include "kinematics.hpp"
+
+// Standard library.
+#include <algorithm>
+
+// SSE is part of every x86-64 target and wasm SIMD is enabled for the web build. Anything else
+// falls back to a scalar loop the compiler is free to vectorize on its own.
+#if defined(__SSE__) || defined(_M_X64)
+    #include <xmmintrin.h>
+    #define KINEMATICS_SIMD_SSE
+#elif defined(__wasm_simd128__)
+    #include <wasm_simd128.h>
+    #define KINEMATICS_SIMD_WASM
+#elif defined(__ARM_NEON)
+    #include <arm_neon.h>
+    #define KINEMATICS_SIMD_NEON
+#endif
+
+using engine::kinematics;
+
+namespace
+{
+    // 'values[i] += deltas[i]' for every i below 'count'.
+    void add_arrays(float* values, const float* deltas, size_t count)
+    {
+        size_t i = 0;
+
+#if defined(KINEMATICS_SIMD_SSE)
+        for (; i + 4 <= count; i += 4) {
+            _mm_storeu_ps(values + i, _mm_add_ps(_mm_loadu_ps(values + i), _mm_loadu_ps(deltas + i)));
+        }
+#elif defined(KINEMATICS_SIMD_WASM)
+        for (; i + 4 <= count; i += 4) {
+            wasm_v128_store(values + i, wasm_f32x4_add(wasm_v128_load(values + i), wasm_v128_load(deltas + i)));
+        }
+#elif defined(KINEMATICS_SIMD_NEON)
+        for (; i + 4 <= count; i += 4) {
+            vst1q_f32(values + i, vaddq_f32(vld1q_f32(values + i), vld1q_f32(deltas + i)));
+        }
+#endif
+
+        for (; i < count; ++i) {
+            values[i] += deltas[i];
+        }
+    }
+}
+
+kinematics::kinematics(std::pmr::memory_resource* resource)
+    :
+    m_x(resource),
+    m_y(resource),
+    m_prev_x(resource),
+    m_prev_y(resource),
+    m_speed_x(resource),
+    m_speed_y(resource)
+{}
+
+size_t kinematics::add(Vector2 position, Vector2 prev_position, Vector2 speed)
+{
+    m_x.push_back(position.x);
+    m_y.push_back(position.y);
+    m_prev_x.push_back(prev_position.x);
+    m_prev_y.push_back(prev_position.y);
+    m_speed_x.push_back(speed.x);
+    m_speed_y.push_back(speed.y);
+    return m_x.size() - 1;
+}
+
+void kinematics::save_state()
+{
+    std::copy(m_x.begin(), m_x.end(), m_prev_x.begin());
+    std::copy(m_y.begin(), m_y.end(), m_prev_y.begin());
+}
+
+void kinematics::integrate()
+{
+    add_arrays(m_x.data(), m_speed_x.data(), m_x.size());
+    add_arrays(m_y.data(), m_speed_y.data(), m_y.size());
+}
@@ -44,9 +44,10 @@ label::label(
     m_thickness(thickness),
 
     // Updated every frame in 'update()'.
-    m_rectangle({m_position.x - (m_size.x / 2.0f), m_position.y - (m_size.y / 2.0f), m_size.x, m_size.y}),
+    m_rectangle({position.x - (m_size.x / 2.0f), position.y - (m_size.y / 2.0f), m_size.x, m_size.y}),
 
-    m_scale(1.0f)
+    m_scale(1.0f),
+    m_prev_scale(m_scale)
 {}
 
 // ------------------------------------------------------------------------------------------ //
@@ -57,26 +58,43 @@ void label::update()
     entity::update();
 
     // update the rectangle, multiplying size elements by scale.
+    const Vector2 position = get_position();
     m_rectangle = {
-        m_position.x - ((m_size.x * m_scale) / 2.0f),
-        m_position.y - ((m_size.y * m_scale) / 2.0f),
+        position.x - ((m_size.x * m_scale) / 2.0f),
+        position.y - ((m_size.y * m_scale) / 2.0f),
         m_size.x * m_scale,
         m_size.y * m_scale
     };
 }
 
-void label::draw()
+void label::save_state()
 {
+    entity::save_state();
+    m_prev_scale = m_scale;
+}
+
+void label::draw(float alpha)
+{
+    // Blend the rectangle between the previous and current tick.
+    const Vector2 position = get_render_position(alpha);
+    const float scale = lerp(m_prev_scale, m_scale, alpha);
+    const Rectangle rec = {
+        position.x - ((m_size.x * scale) / 2.0f),
+        position.y - ((m_size.y * scale) / 2.0f),
+        m_size.x * scale,
+        m_size.y * scale
+    };
+
     // draw the filled portion.
-    DrawRectangleRec(m_rectangle, m_fill_color);
+    DrawRectangleRec(rec, m_fill_color);
 
     // draw the four lines of the rect if an above-zero thickness is specified.
     if (m_thickness > 0) {
-        DrawRectangle(m_rectangle.x, m_rectangle.y, m_thickness, m_rectangle.height, m_line_color); // Left column.
-        DrawRectangle(m_rectangle.x + m_rectangle.width - m_thickness, m_rectangle.y,
-                      m_thickness, m_rectangle.height, m_line_color); // Right column.
-        DrawRectangle(m_rectangle.x, m_rectangle.y, m_rectangle.width, m_thickness, m_line_color); // Top row.
-        DrawRectangle(m_rectangle.x, m_rectangle.y + m_rectangle.height - m_thickness,
-                      m_rectangle.width, m_thickness, m_line_color); // Bottom row.
+        DrawRectangle(rec.x, rec.y, m_thickness, rec.height, m_line_color); // Left column.
+        DrawRectangle(rec.x + rec.width - m_thickness, rec.y,
+                      m_thickness, rec.height, m_line_color); // Right column.
+        DrawRectangle(rec.x, rec.y, rec.width, m_thickness, m_line_color); // Top row.
+        DrawRectangle(rec.x, rec.y + rec.height - m_thickness,
+                      rec.width, m_thickness, m_line_color); // Bottom row.
     }
 }
@@ -24,6 +24,7 @@
 #include "text.hpp"
 #include "button.hpp"
 #include "overlay.hpp"
+#include "zone.hpp"
 
 using engine::game;
 using engine::level;
@@ -34,11 +35,17 @@ using engine::overlay;
 level::level()
     :
     m_game(game::get_instance()),
-    m_entities{},
-    m_buttons{}
+    m_arena(m_arena_initial_size, m_game.get_level_memory()),
+    m_entities(&m_arena),
+    m_buttons(&m_arena),
+    m_button_grid(&m_arena),
+    m_hovered_button(nullptr),
+    m_kinematics(&m_arena)
 {
+    m_game.random->begin_level();
+
     add_entity(
-        new background(
+        new (m_arena) background(
             { 145, 145, 145, 255 },
             { 180, 180, 180, 255 },
             50
@@ -48,32 +55,91 @@ level::level()
 
 level::~level()
 {
-    for (entity* ent : m_entities) {
+    // Runs each destructor. The memory goes back when 'm_arena' is destroyed after this.
+    m_entities.for_each([this](entity* ent) {
+        m_game.handles->remove(ent);
         delete ent;
-    }
+    });
     m_entities.clear();
     m_buttons.clear();
+    m_button_grid.clear();
+}
+
+void level::add_to_level(entity* ent, size_t type)
+{
+    ent->attach(m_kinematics);
+    m_entities.add(ent, type);
+    m_game.handles->add(ent);
 }
 
 void level::update()
 {
-    for (const auto& ent : m_entities) {
+    GAME_ZONE_FUNCTION();
+
+    m_entities.rebucket();
+
+    // Move everything first, in one pass over the store, then run the per-type updates.
+    m_kinematics.save_state();
+    m_kinematics.integrate();
+
+    resolve_hover();
+
+    m_entities.for_each_awake([this](auto* ent) {
+        ent->save_state();
         ent->update();
-    }
+
+        if constexpr (std::is_same_v<decltype(ent), button*>) {
+            m_button_grid.place(ent, ent->get_scaled_rec());
+        }
+
+        return !ent->is_resting();
+    });
 }
 
-void level::draw()
+void level::resolve_hover()
 {
-    for (const auto& ent : m_entities) {
-        ent->draw();
+    GAME_ZONE_FUNCTION();
+
+    // The button drawn on top is hovered. That is the last in draw order, which is not the
+    // order the grid visits them in, as a button moved to a layer is drawn last within it.
+    button* hovered = nullptr;
+    m_button_grid.query_point(m_game.get_mouse_position(), [this, &hovered](entity* ent) {
+        button* const btn = static_cast<button*>(ent);
+        if (hovered == nullptr || m_entities.is_drawn_above(btn, hovered)) {
+            hovered = btn;
+        }
+    });
+
+    if (hovered != m_hovered_button) {
+        if (m_hovered_button != nullptr) {
+            m_hovered_button->set_hovered(false);
+        }
+        if (hovered != nullptr) {
+            hovered->set_hovered(true);
+        }
+        m_hovered_button = hovered;
     }
 }
 
+button* level::get_pressed_button()
+{
+    return m_game.is_mouse_button_pressed(MOUSE_BUTTON_LEFT) ? m_hovered_button : nullptr;
+}
+
+void level::draw(float alpha)
+{
+    GAME_ZONE_FUNCTION();
+
+    // Layers changed by the last ticks take effect once per frame, before anything is drawn.
+    m_entities.rebucket();
+    m_entities.for_each_typed([alpha](auto* ent) { ent->draw(alpha); });
+}
+
 // Create a simple text with a black outline.
 text* level::add_simple_text(string text_str, float font_size, Color text_color,
                              Vector2 position, int layer)
 {
-    text* const text_obj = new text(text_str, font_size, text_color, position, layer);
+    text* const text_obj = new (m_arena) text(text_str, font_size, text_color, position, layer);
     add_entity(text_obj);
     return text_obj;
 }
@@ -86,14 +152,14 @@ button* level::add_ui_button(string text_str)
         game::get_ch() + 100
     };
     constexpr int layer = 1;
-    text* const text_obj = new text(text_str, 40, WHITE, position, layer, BLACK, 2.0f);
-    button* const btn = new button(
+    text* const text_obj = new (m_arena) text(text_str, 40, WHITE, position, layer, BLACK, 2.0f);
+    button* const btn = new (m_arena) button(
         text_obj,
         DARKGRAY,
         {position.x - 90.0f, position.y - 30.0f, 180.0f, 60.0f},
         layer
     );
-    btn->add_trait(new grows_when_hovered());
+    btn->add_trait(grows_when_hovered());
     btn->set_sfx_press(m_game.audio->get_sound_effect("click"));
     add_entity(btn);
     return btn;
@@ -103,7 +169,7 @@ button* level::add_ui_button(string text_str)
 button* level::add_text_button(string text_str, int font_size, Color text_color, Vector2 position)
 {
     constexpr int layer = 1;
-    text* const text_obj = new text(text_str, font_size, text_color, position, layer);
+    text* const text_obj = new (m_arena) text(text_str, font_size, text_color, position, layer);
     Rectangle const text_rec = text_obj->get_rec();
     Rectangle const btn_rec = {
         position.x - text_rec.width / 2.0f,
@@ -111,7 +177,7 @@ button* level::add_text_button(string text_str, int font_size, Color text_color,
         text_rec.width,
         text_rec.height
     };
-    button* const btn = new button(text_obj, {0, 0, 0, 0}, btn_rec, layer, {0, 0, 0, 0}, 0);
+    button* const btn = new (m_arena) button(text_obj, {0, 0, 0, 0}, btn_rec, layer, {0, 0, 0, 0}, 0);
     btn->set_sfx_press(m_game.audio->get_sound_effect("grab"));
     add_entity(btn);
     return btn;
@@ -21,13 +21,136 @@
 // Source.
 #include "game.hpp"
 #include "game_levels.hpp"
+#include "zone.hpp"
+#include "dispatch_bench.hpp"
 
 // Standard library.
 #include <cmath>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <iostream>
 
-int main(void)
+using std::string;
+
+int main(int argc, char** argv)
 {
+    size_t tick_limit = 0;
+    std::optional<unsigned long> seed;
+    string record_path;
+    string replay_path;
+    std::optional<float> frame_budget_ms;
+    string report_prefix;
+    bool assert_no_alloc = false;
+    size_t bench_entity_count = 0;
+
+    const auto print_usage = [argv]() {
+        std::cerr << "Usage: " << argv[0] << " [--headless] [--ticks <count>] [--seed <seed>]"
+                  << " [--record <file> | --replay <file>] [--trace <file>]"
+                  << " [--frame-budget <ms>] [--report <prefix>] [--assert-no-alloc]"
+                  << " [--bench-dispatch <entities>]\n";
+    };
+
+    // The numeric options throw 'std::invalid_argument' on values that are not numbers, and
+    // 'std::out_of_range' on ones too large. Both are logic errors.
+    try {
+        for (int i = 1; i < argc; ++i) {
+            const string arg = argv[i];
+            const bool has_value = i + 1 < argc;
+
+            if (arg == "--headless") {
+                engine::game::set_headless(true);
+            }
+            else if (arg == "--ticks" && has_value) {
+                tick_limit = std::stoul(argv[++i]);
+            }
+            else if (arg == "--seed" && has_value) {
+                seed = std::stoul(argv[++i]);
+            }
+            else if (arg == "--record" && has_value) {
+                record_path = argv[++i];
+            }
+            else if (arg == "--replay" && has_value) {
+                replay_path = argv[++i];
+            }
+            else if (arg == "--trace" && has_value) {
+                engine::zone_recorder::get_instance().set_path(argv[++i]);
+            }
+            else if (arg == "--assert-no-alloc") {
+#ifndef GAME_ALLOC_TRACKING
+                // Without tracking every frame would pass, so a check that cannot run is an error.
+                std::cerr << "--assert-no-alloc needs a build with allocation tracking (make linux ALLOCS=1).\n";
+                return 1;
+#endif
+                assert_no_alloc = true;
+            }
+            else if (arg == "--report" && has_value) {
+                report_prefix = argv[++i];
+            }
+            else if (arg == "--frame-budget" && has_value) {
+                frame_budget_ms = std::stof(argv[++i]);
+            }
+            else if (arg == "--bench-dispatch" && has_value) {
+                bench_entity_count = std::stoul(argv[++i]);
+            }
+            else {
+                print_usage();
+                return 1;
+            }
+        }
+    }
+    catch (const std::logic_error&) {
+        std::cerr << "A numeric option was given a value that is not a number, or is out of range.\n";
+        print_usage();
+        return 1;
+    }
+
+    // Recording while replaying would only copy the replay.
+    if (!record_path.empty() && !replay_path.empty()) {
+        std::cerr << "--record and --replay cannot be used together.\n";
+        print_usage();
+        return 1;
+    }
+
+    // Nothing else ends a headless game, which would otherwise run flat out forever.
+    if (engine::game::is_headless() && bench_entity_count == 0 && tick_limit == 0 && replay_path.empty()) {
+        std::cerr << "--headless needs --ticks or --replay to know when to stop.\n";
+        print_usage();
+        return 1;
+    }
+
+    if (bench_entity_count > 0) {
+        constexpr size_t bench_rounds = 600;
+        engine::run_dispatch_bench(bench_entity_count, bench_rounds);
+        return 0;
+    }
+
     engine::game& game_inst = engine::game::get_instance();
+    game_inst.set_tick_limit(tick_limit);
+
+    game_inst.set_assert_no_alloc(assert_no_alloc);
+
+    if (!report_prefix.empty()) {
+        game_inst.report->set_path_prefix(report_prefix);
+    }
+
+    if (frame_budget_ms.has_value()) {
+        game_inst.flight->set_budget_ms(*frame_budget_ms);
+    }
+
+    if (seed.has_value()) {
+        game_inst.set_seed(*seed);
+    }
+
+    // A replay restores the seed it was recorded with, so it is started after '--seed'.
+    if (!replay_path.empty() && !game_inst.start_replay(replay_path)) {
+        return 1;
+    }
+
+    if (!record_path.empty() && !game_inst.start_recording(record_path)) {
+        return 1;
+    }
+
     game_inst.set_next_level(new intro_raylib());
     game_inst.run();
     return 0;
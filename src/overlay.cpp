@@ -34,7 +34,8 @@ overlay::overlay(Color color, Vector2 position, int layer)
 void overlay::update()
 {}
 
-void overlay::draw()
+void overlay::draw(float /* alpha */)
 {
-    DrawRectangle(m_position.x, m_position.y, game::get_w(), game::get_h(), m_color);
+    const Vector2 position = get_position();
+    DrawRectangle(position.x, position.y, game::get_w(), game::get_h(), m_color);
 }
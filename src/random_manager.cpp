@@ -0,0 +1,142 @@
+/***********************************************************************************************
+*
+*   random_manager.cpp - Seedable random number streams for the game engine.
+*
+*   Copyright (c) 2025 Josh Hayden (@BlinkDynamo)
+*
+*   Blink's Thinks is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License v3.0 as published
+*   by the Free Software Foundation.
+*
+*   Blink's Thinks is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*
+***********************************************************************************************/
+
+// Source.
+#include "game.hpp"
+#include "random_manager.hpp"
+
+// Standard library.
+#include <algorithm>
+
+using engine::random_manager;
+
+random_manager::random_manager(uint32_t seed)
+{
+    set_seed(seed);
+}
+
+void random_manager::set_seed(uint32_t seed)
+{
+    m_seed = seed;
+    m_level_index = 0;
+    derive_streams();
+}
+
+void random_manager::begin_level()
+{
+    ++m_level_index;
+    derive_streams();
+}
+
+int random_manager::get_value(stream s, int min, int max)
+{
+    GAME_ASSERT(max >= min, "Invalid range supplied.");
+    const uint64_t range = static_cast<int64_t>(max) - min + 1;
+    return static_cast<int>(min + static_cast<int64_t>(get_bounded(s, range)));
+}
+
+void random_manager::get_sequence(stream s, std::span<int> out, int min, int max,
+                                  std::initializer_list<int> exclude)
+{
+    // Count the distinct excluded values that fall in range.
+    auto is_new_exclusion = [&](const int* it) {
+        return *it >= min && *it <= max && std::find(exclude.begin(), it, *it) == it;
+    };
+    auto count_excluded_up_to = [&](int value) {
+        int count = 0;
+        for (const int* it = exclude.begin(); it != exclude.end(); ++it) {
+            count += (is_new_exclusion(it) && *it <= value) ? 1 : 0;
+        }
+        return count;
+    };
+
+    const int64_t candidate_count = static_cast<int64_t>(max) - min + 1 - count_excluded_up_to(max);
+    GAME_ASSERT(
+        static_cast<int64_t>(out.size()) <= candidate_count,
+        "Requested more unique numbers than available range."
+    );
+
+    // Floyd's algorithm picks 'out.size()' distinct indices into the candidates. Index 'j' is
+    // taken whenever the sampled index was already chosen.
+    size_t filled = 0;
+    for (int64_t j = candidate_count - static_cast<int64_t>(out.size()); j < candidate_count; ++j) {
+        const int index = static_cast<int>(get_bounded(s, j + 1));
+        const bool already_chosen = std::find(out.begin(), out.begin() + filled, index) != out.begin() + filled;
+        out[filled++] = already_chosen ? static_cast<int>(j) : index;
+    }
+
+    // Map each candidate index to its value by stepping over the excluded values below it.
+    for (int& value : out) {
+        const int index = value;
+        value = min + index;
+        int next = min + index + count_excluded_up_to(value);
+        while (next != value) {
+            value = next;
+            next = min + index + count_excluded_up_to(value);
+        }
+    }
+
+    // Floyd's algorithm picks a uniform set, but not a uniform order.
+    shuffle(s, out);
+}
+
+uint32_t random_manager::generator::next()
+{
+    const uint64_t old_state = state;
+    state = old_state * 6364136223846793005ULL + increment;
+    const uint32_t xor_shifted = static_cast<uint32_t>(((old_state >> 18u) ^ old_state) >> 27u);
+    const uint32_t rotation = static_cast<uint32_t>(old_state >> 59u);
+    return (xor_shifted >> rotation) | (xor_shifted << ((0u - rotation) & 31u));
+}
+
+uint32_t random_manager::get_bounded(stream s, uint64_t range)
+{
+    GAME_ASSERT(range > 0 && range <= UINT32_MAX, "Invalid range supplied.");
+    generator& gen = m_streams[static_cast<size_t>(s)];
+    const uint32_t bound = static_cast<uint32_t>(range);
+
+    uint64_t product = static_cast<uint64_t>(gen.next()) * bound;
+    uint32_t low = static_cast<uint32_t>(product);
+    if (low < bound) {
+        const uint32_t threshold = (0u - bound) % bound;
+        while (low < threshold) {
+            product = static_cast<uint64_t>(gen.next()) * bound;
+            low = static_cast<uint32_t>(product);
+        }
+    }
+    return static_cast<uint32_t>(product >> 32);
+}
+
+uint64_t random_manager::split_mix(uint64_t& state)
+{
+    uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+void random_manager::derive_streams()
+{
+    for (size_t i = 0; i < m_streams.size(); ++i) {
+        uint64_t mix = (static_cast<uint64_t>(m_seed) << 32) ^ (static_cast<uint64_t>(m_level_index) << 8) ^ i;
+        m_streams[i].state = split_mix(mix);
+        m_streams[i].increment = split_mix(mix) | 1u;
+    }
+}
@@ -21,6 +21,7 @@
 // Source.
 #include "game.hpp"
 #include "shader_manager.hpp"
+#include "zone.hpp"
 
 // Standard library.
 #include <algorithm>
@@ -28,8 +29,17 @@
 using engine::game;
 using engine::shader_manager;
 
-shader_manager::shader_manager()
+shader_manager::shader_manager(bool headless)
 {
+    m_in_texture_mode = false;
+    m_headless = headless;
+
+    if (m_headless) {
+        m_target_a = {};
+        m_target_b = {};
+        return;
+    }
+
     m_target_a = LoadRenderTexture(game::get_w(), game::get_h());
     m_target_b = LoadRenderTexture(game::get_w(), game::get_h());
 
@@ -39,12 +49,12 @@ shader_manager::shader_manager()
     int resolution_loc = GetShaderLocation(m_shaders.at("vignette"), "resolution");
     float resolution[2] = {static_cast<float>(game::get_w()), static_cast<float>(game::get_h())};
     SetShaderValue(m_shaders.at("vignette"), resolution_loc, resolution, SHADER_UNIFORM_VEC2);
-
-    m_in_texture_mode = false;
 }
 
 shader_manager::~shader_manager()
 {
+    if (m_headless) return;
+
     UnloadRenderTexture(m_target_a);
     UnloadRenderTexture(m_target_b);
 
@@ -55,17 +65,25 @@ shader_manager::~shader_manager()
 
 void engine::shader_manager::begin()
 {
+    if (m_headless) return;
+
     BeginTextureMode(m_target_a);
     m_in_texture_mode = true;
 }
 
 void engine::shader_manager::append(string shader_name)
 {
+    if (m_headless) return;
+
     m_shader_queue.push_back(shader_name);
 }
 
 void engine::shader_manager::process()
 {
+    GAME_ZONE_FUNCTION();
+
+    if (m_headless) return;
+
     if (m_in_texture_mode) {
         EndTextureMode();
         m_in_texture_mode = false;
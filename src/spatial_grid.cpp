@@ -0,0 +1,102 @@
+/***********************************************************************************************
+*
+*   spatial_grid.cpp - A uniform grid over the canvas for finding entities by position.
+*
+*   Copyright (c) 2025 Josh Hayden (@BlinkDynamo)
+*
+*   Blink's Thinks is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License v3.0 as published
+*   by the Free Software Foundation.
+*
+*   Blink's Thinks is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*
+***********************************************************************************************/
+
+// Source.
+#include "spatial_grid.hpp"
+#include "game.hpp"
+
+// Standard library.
+#include <algorithm>
+#include <cmath>
+
+using engine::spatial_grid;
+using engine::game;
+
+spatial_grid::spatial_grid(std::pmr::memory_resource* resource)
+    :
+    m_cols(static_cast<int>(std::ceil(game::get_w() / m_cell_size))),
+    m_rows(static_cast<int>(std::ceil(game::get_h() / m_cell_size))),
+    m_entries(resource),
+    m_cells(static_cast<size_t>(m_cols * m_rows), resource)
+{}
+
+void spatial_grid::place(entity* ent, Rectangle rec)
+{
+    const cell_range cells = cells_of(rec);
+
+    if (ent->m_grid_slot == entity::m_no_grid_slot) {
+        const uint32_t slot = static_cast<uint32_t>(m_entries.size());
+        m_entries.push_back({ent, rec, cells});
+        file(slot, cells);
+        ent->m_grid_slot = slot;
+        return;
+    }
+
+    entry& e = m_entries[ent->m_grid_slot];
+    e.rec = rec;
+    if (cells != e.cells) {
+        unfile(ent->m_grid_slot, e.cells);
+        file(ent->m_grid_slot, cells);
+        e.cells = cells;
+    }
+}
+
+void spatial_grid::clear()
+{
+    m_entries.clear();
+    for (std::pmr::vector<uint32_t>& cell : m_cells) {
+        cell.clear();
+    }
+}
+
+int spatial_grid::cell_x(float x)
+{
+    return std::clamp(static_cast<int>(std::floor(x / m_cell_size)), 0, m_cols - 1);
+}
+
+int spatial_grid::cell_y(float y)
+{
+    return std::clamp(static_cast<int>(std::floor(y / m_cell_size)), 0, m_rows - 1);
+}
+
+spatial_grid::cell_range spatial_grid::cells_of(Rectangle rec)
+{
+    return {cell_x(rec.x), cell_y(rec.y), cell_x(rec.x + rec.width), cell_y(rec.y + rec.height)};
+}
+
+void spatial_grid::file(uint32_t slot, cell_range cells)
+{
+    for (int y = cells.y0; y <= cells.y1; ++y) {
+        for (int x = cells.x0; x <= cells.x1; ++x) {
+            std::pmr::vector<uint32_t>& cell = m_cells[x + y * m_cols];
+            cell.insert(std::lower_bound(cell.begin(), cell.end(), slot), slot);
+        }
+    }
+}
+
+void spatial_grid::unfile(uint32_t slot, cell_range cells)
+{
+    for (int y = cells.y0; y <= cells.y1; ++y) {
+        for (int x = cells.x0; x <= cells.x1; ++x) {
+            std::pmr::vector<uint32_t>& cell = m_cells[x + y * m_cols];
+            cell.erase(std::lower_bound(cell.begin(), cell.end(), slot));
+        }
+    }
+}
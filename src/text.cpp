@@ -20,11 +20,14 @@
 
 // Source.
 #include "text.hpp"
+#include "game.hpp"
+#include "zone.hpp"
 
 // Standard library.
 #include <cmath>
 
 using engine::text;
+using engine::game;
 
 text::text(
     string text_str,
@@ -36,96 +39,117 @@ text::text(
     float outline_size)
     :
     entity(position, layer),
-    m_font(GetFontDefault()),
+    m_font(game::get_instance().fonts->get_text_font()),
     m_text_str(text_str),
     m_scale(1.0f),
     m_base_font_size(font_size),
-    m_scaled_font_size(m_base_font_size * m_scale),
     m_text_color(text_color),
     m_outline_color(outline_color),
-    m_letter_spacing(m_base_font_size / 10.0f),
     m_rec{},
     m_origin{},
     m_outline_size(outline_size),
     m_rotation(0.0f),
     m_rotation_speed(0.0f),
-    m_rotation_depth(0.0f)
+    m_rotation_depth(0.0f),
+    m_prev_scale(m_scale),
+    m_prev_rotation(m_rotation),
+    m_run(),
+    m_run_dirty(true),
+    m_mesh(),
+    m_mesh_dirty(true),
+    m_layout_dirty(true)
 {
-    Vector2 const text_dim = MeasureTextEx(
-        m_font,
-        m_text_str.c_str(),
-        m_scaled_font_size,
-        m_letter_spacing
-    );
-    m_rec = {
-        m_position.x,
-        m_position.y,
-        text_dim.x,
-        text_dim.y
-    };
-    m_origin = {
-        m_rec.width / 2.0f,
-        m_rec.height / 2.0f
-    };
+    m_rec.x = position.x;
+    m_rec.y = position.y;
+    layout();
 }
 
 void text::update()
 {
+    GAME_ZONE_FUNCTION();
+
     entity::update();
-    m_scaled_font_size = m_base_font_size * m_scale;
-    m_letter_spacing = m_scaled_font_size / 10.0f;
-    Vector2 const text_dim = MeasureTextEx(
-        m_font,
-        m_text_str.c_str(),
-        m_scaled_font_size,
-        m_letter_spacing
-    );
-    m_rec = {
-        m_position.x,
-        m_position.y,
-        text_dim.x,
-        text_dim.y
-    };
+
+    if (m_layout_dirty) {
+        layout();
+    }
+
+    const Vector2 position = get_position();
+    m_rec.x = position.x;
+    m_rec.y = position.y;
+    m_rotation = sin(game::get_instance().get_sim_time() * m_rotation_speed) * m_rotation_depth;
+}
+
+void text::layout()
+{
+    if (m_run_dirty) {
+        // Letters are spaced a whole number of pixels apart at the base font size.
+        const int letter_spacing = m_base_font_size / 10.0f;
+        m_run.build(m_font, m_text_str, m_base_font_size, letter_spacing);
+        m_run_dirty = false;
+        m_mesh_dirty = true;
+    }
+
+    Vector2 const text_dim = m_run.get_size();
+    m_rec.width = text_dim.x * m_scale;
+    m_rec.height = text_dim.y * m_scale;
     m_origin = {
         m_rec.width / 2.0f,
         m_rec.height / 2.0f
     };
-    m_rotation = sin(GetTime() * m_rotation_speed) * m_rotation_depth;
+    m_layout_dirty = false;
 }
 
-void text::draw()
+void text::save_state()
 {
-    // Draw outline by rendering text in 8 directions around the center.
-    // Only draw the outline if it has a visible alpha and non-zero size.
-    if (m_outline_color.a != 0 && m_outline_size > 0.0f) {
-        for (int i = 0; i < 8; ++i) {
-            float angle = i * (PI * 2.0f) / 8.0f;
-            Vector2 offset = {
-                cosf(angle) * m_outline_size,
-                sinf(angle) * m_outline_size
-            };
-            DrawTextPro(
-                m_font,
-                m_text_str.c_str(),
-                { m_position.x + offset.x, m_position.y + offset.y },
-                m_origin,
-                m_rotation,
-                m_scaled_font_size,
-                m_letter_spacing,
-                m_outline_color
-            );
-        }
+    entity::save_state();
+    m_prev_scale = m_scale;
+    m_prev_rotation = m_rotation;
+}
+
+bool text::is_resting()
+{
+    const bool rotating = m_rotation_speed != 0.0f && m_rotation_depth != 0.0f;
+    return is_still() && !rotating && m_scale == m_prev_scale && m_rotation == m_prev_rotation;
+}
+
+void text::draw(float alpha)
+{
+    GAME_ZONE_FUNCTION();
+
+    // Blend the transform between the previous and current tick. The run grows linearly with
+    // its scale, so the origin is scaled instead of laying it out again.
+    const Vector2 position = get_render_position(alpha);
+    const float rotation = lerp(m_prev_rotation, m_rotation, alpha);
+    const float scale = lerp(m_prev_scale, m_scale, alpha);
+    const float scale_ratio = (m_scale > 0.0f) ? scale / m_scale : 1.0f;
+    const Vector2 origin = {m_origin.x * scale_ratio, m_origin.y * scale_ratio};
+
+    if (m_mesh_dirty) {
+        m_mesh.bake(m_run);
+        m_mesh_dirty = false;
     }
 
-    // Draw main text on top.
-    DrawTextPro(
-        m_font,
-        m_text_str.c_str(),
-        m_position,
-        m_origin,
-        m_rotation,
-        m_scaled_font_size,
-        m_letter_spacing,
-        m_text_color
+    // The mesh is in the space of the run at its base font size. Scale it, rotate it about
+    // 'origin' and move that point to 'position'.
+    const float cos_r = cosf(rotation * DEG2RAD);
+    const float sin_r = sinf(rotation * DEG2RAD);
+    const Matrix transform = {
+        cos_r * scale, -sin_r * scale, 0.0f, position.x - (cos_r * origin.x - sin_r * origin.y),
+        sin_r * scale,  cos_r * scale, 0.0f, position.y - (sin_r * origin.x + cos_r * origin.y),
+        0.0f,           0.0f,          1.0f, 0.0f,
+        0.0f,           0.0f,          0.0f, 1.0f
+    };
+
+    // The fill and outline come from the same glyph quads, drawn with the text shader.
+    game& game_inst = game::get_instance();
+    const size_t drawn = game_inst.fonts->draw_text(
+        m_mesh,
+        transform,
+        m_text_color,
+        m_outline_color,
+        m_outline_size,
+        m_base_font_size * scale
     );
+    game_inst.profiler->count_glyphs(drawn, m_mesh.size() - drawn);
 }
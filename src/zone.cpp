@@ -0,0 +1,87 @@
+/***********************************************************************************************
+*
+*   zone.cpp - Scoped instrumentation zones and their trace-event export.
+*
+*   Copyright (c) 2025 Josh Hayden (@BlinkDynamo)
+*
+*   Blink's Thinks is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License v3.0 as published
+*   by the Free Software Foundation.
+*
+*   Blink's Thinks is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*
+***********************************************************************************************/
+
+// Source.
+#include "zone.hpp"
+
+// Raylib.
+#include "raylib.h"
+
+// Standard library.
+#include <cstdio>
+
+using engine::zone_recorder;
+
+zone_recorder::zone_recorder()
+    :
+    m_next(0),
+    m_origin(clock::now()),
+    m_path("trace.json")
+{}
+
+void zone_recorder::record(const char* name, clock::time_point start, clock::time_point end)
+{
+    const event ev = {
+        name,
+        std::chrono::duration_cast<std::chrono::nanoseconds>(start - m_origin).count(),
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()
+    };
+
+    if (m_events.size() < m_max_events) {
+        m_events.push_back(ev);
+        return;
+    }
+
+    m_events[m_next] = ev;
+    m_next = (m_next + 1) % m_max_events;
+}
+
+bool zone_recorder::write(const string& path)
+{
+    std::FILE* file = std::fopen(path.c_str(), "w");
+    if (file == nullptr) {
+        TraceLog(LOG_ERROR, "[%s] Could not open '%s' for writing.", __PRETTY_FUNCTION__, path.c_str());
+        return false;
+    }
+
+    std::fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", file);
+
+    // Oldest first. Before the ring wraps 'm_next' is zero, so this is just insertion order.
+    for (size_t i = 0; i < m_events.size(); ++i) {
+        const event& ev = m_events[(m_next + i) % m_events.size()];
+
+        // Zones are named by string literals and '__PRETTY_FUNCTION__', neither of which
+        // contain characters that need escaping in JSON.
+        std::fprintf(
+            file,
+            "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f}\n",
+            i == 0 ? "" : ",",
+            ev.name,
+            ev.start_ns / 1000.0,
+            ev.duration_ns / 1000.0
+        );
+    }
+
+    std::fputs("]}\n", file);
+    std::fclose(file);
+
+    TraceLog(LOG_INFO, "[%s] Wrote %zu zones to '%s'.", __PRETTY_FUNCTION__, m_events.size(), path.c_str());
+    return true;
+}